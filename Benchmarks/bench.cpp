@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../Headers/StarBTree.hpp"
+#include "../Headers/StarBTreeConcurrente.hpp"
+
+/**
+ * @file bench.cpp
+ * @brief Microbenchmarks de inserción y búsqueda de StarBTree contra std::set.
+ * @details Cada combinación de estructura, tipo de clave, grado y carga corre en un proceso
+ * hijo, de modo que el pico de memoria (ru_maxrss) es el de esa combinación sola; incluye
+ * las claves generadas, que son las mismas para todas las estructuras. La salida es CSV
+ * con una fila por operación medida:
+ *
+ *     estructura,tipo,grado,carga,operacion,n,exitos,ns_op,ops_seg,rss_kb,altura
+ *
+ * Las filas "StarBTree/<política>" repiten grado 64 con otra política de desborde
+ * (ver PoliticaDesborde.hpp); las "StarBTree" usan la del vecino, por defecto. Las filas
+ * "StarBTreeConcurrente/<h>h" reparten las inserciones y luego las búsquedas entre h
+ * hilos; ns_op es el tiempo total dividido por n, así que ops_seg es el rendimiento agregado.
+ *
+ * Uso: ./benchmark [n] (n claves por carga, 200000 por defecto).
+ */
+
+using namespace std;
+
+/**
+ * @brief Generador Zipf sobre [0, n) con el método de Gray et al. (el de YCSB).
+ */
+class Zipf {
+public:
+    Zipf(uint64_t n, double theta) : n(n), theta(theta), alfa(1.0 / (1.0 - theta)) {
+        zetaN = Zeta(n, theta);
+        double zeta2 = Zeta(2, theta);
+        eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / zetaN);
+    }
+
+    template <typename Generador>
+    uint64_t operator()(Generador& g) {
+        double u = uniform_real_distribution<double>(0.0, 1.0)(g);
+        double uz = u * zetaN;
+        if (uz < 1.0) return 0;
+        if (uz < 1.0 + pow(0.5, theta)) return 1;
+        uint64_t rango = static_cast<uint64_t>(n * pow(eta * u - eta + 1.0, alfa));
+        return rango < n ? rango : n - 1;
+    }
+
+private:
+    uint64_t n;
+    double theta, alfa, zetaN, eta;
+
+    static double Zeta(uint64_t n, double theta) {
+        double suma = 0;
+        for (uint64_t i = 1; i <= n; ++i) suma += 1.0 / pow(static_cast<double>(i), theta);
+        return suma;
+    }
+};
+
+/// Dispersa un rango de Zipf para que las claves calientes no queden contiguas
+static uint64_t Mezclar(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+enum class Carga { Aleatoria, Secuencial, Zipf };
+
+static const char* Nombre(Carga c) {
+    switch (c) {
+        case Carga::Aleatoria: return "aleatoria";
+        case Carga::Secuencial: return "secuencial";
+        default: return "zipf";
+    }
+}
+
+/**
+ * @brief Semillas enteras de las claves a insertar y a buscar para una carga.
+ * @details Aleatoria busca las claves insertadas en otro orden; secuencial inserta y busca
+ * en orden ascendente; Zipf (theta = 0.99) inserta con repeticiones y busca con otra muestra.
+ */
+static void Semillas(Carga carga, size_t n, vector<uint64_t>& inserciones, vector<uint64_t>& busquedas) {
+    mt19937_64 g(42);
+    inserciones.resize(n);
+    busquedas.resize(n);
+    switch (carga) {
+        case Carga::Aleatoria:
+            for (auto& x : inserciones) x = g();
+            busquedas = inserciones;
+            shuffle(busquedas.begin(), busquedas.end(), g);
+            break;
+        case Carga::Secuencial:
+            for (size_t i = 0; i < n; ++i) inserciones[i] = busquedas[i] = i;
+            break;
+        case Carga::Zipf: {
+            Zipf zipf(n, 0.99);
+            for (auto& x : inserciones) x = Mezclar(zipf(g));
+            for (auto& x : busquedas) x = Mezclar(zipf(g));
+            break;
+        }
+    }
+}
+
+/// Conversión de una semilla al tipo de clave, conservando el orden de las semillas
+template <typename Type> struct Clave;
+
+template <> struct Clave<int32_t> {
+    static const char* Nombre() { return "int32"; }
+    static int32_t De(uint64_t x) { return static_cast<int32_t>(x ^ 0x80000000u); }
+};
+
+template <> struct Clave<int64_t> {
+    static const char* Nombre() { return "int64"; }
+    static int64_t De(uint64_t x) { return static_cast<int64_t>(x ^ 0x8000000000000000ULL); }
+};
+
+// Claves con un prefijo largo en común, como rutas o URL
+template <> struct Clave<string> {
+    static const char* Nombre() { return "string"; }
+    static string De(uint64_t x) {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "/usuarios/%016" PRIx64, x);
+        return buf;
+    }
+};
+
+// Adaptadores para medir StarBTree (con cualquier política) y std::set con el mismo código
+template <typename Arbol, typename Type>
+static bool Insertar(Arbol& a, const Type& x) { return a.Insertar(x); }
+template <typename Arbol, typename Type>
+static bool Buscar(const Arbol& a, const Type& x) { return a.Buscar(x); }
+template <typename Arbol>
+static int Altura(const Arbol& a) { return a.Altura(); }
+
+template <typename Type>
+static bool Insertar(set<Type>& s, const Type& x) { return s.insert(x).second; }
+template <typename Type>
+static bool Buscar(const set<Type>& s, const Type& x) { return s.count(x) != 0; }
+template <typename Type>
+static int Altura(const set<Type>&) { return -1; } // No se expone
+template <typename Type, int grado, typename Compare>
+static int Altura(const StarBTreeConcurrente<Type, grado, Compare>&) { return -1; }
+
+/// Hilos entre los que se reparten las operaciones: solo las estructuras concurrentes usan varios
+template <typename Estructura>
+struct Hilos {
+    static int Cantidad() { return 1; }
+};
+template <typename Type, int grado, typename Compare>
+struct Hilos<StarBTreeConcurrente<Type, grado, Compare>> {
+    static int Cantidad() { return max(4u, thread::hardware_concurrency()); }
+};
+
+/**
+ * @brief Aplica fn a cada clave, en tramos contiguos repartidos entre hilos.
+ * @return Cantidad de llamadas que devolvieron true.
+ */
+template <typename Type, typename Funcion>
+static size_t Repartir(const vector<Type>& claves, int hilos, Funcion fn) {
+    if (hilos == 1) {
+        size_t exitos = 0;
+        for (const Type& x : claves) exitos += fn(x);
+        return exitos;
+    }
+
+    vector<size_t> exitos(hilos, 0);
+    vector<thread> trabajadores;
+    for (int h = 0; h < hilos; ++h) {
+        trabajadores.emplace_back([&, h] {
+            size_t propios = 0;
+            for (size_t i = claves.size() * h / hilos; i < claves.size() * (h + 1) / hilos; ++i) {
+                propios += fn(claves[i]);
+            }
+            exitos[h] = propios;
+        });
+    }
+    for (thread& t : trabajadores) t.join();
+
+    size_t total = 0;
+    for (size_t e : exitos) total += e;
+    return total;
+}
+
+/**
+ * @brief Mide inserción y búsqueda de una estructura en el proceso actual e imprime dos filas.
+ */
+template <typename Estructura, typename Type>
+static void Medir(const char* estructura, int grado, Carga carga, size_t n) {
+    vector<uint64_t> semillasIns, semillasBus;
+    Semillas(carga, n, semillasIns, semillasBus);
+    vector<Type> inserciones, busquedas;
+    inserciones.reserve(n);
+    busquedas.reserve(n);
+    for (uint64_t x : semillasIns) inserciones.push_back(Clave<Type>::De(x));
+    for (uint64_t x : semillasBus) busquedas.push_back(Clave<Type>::De(x));
+    vector<uint64_t>().swap(semillasIns);
+    vector<uint64_t>().swap(semillasBus);
+
+    Estructura e;
+    using Reloj = chrono::steady_clock;
+    int hilos = Hilos<Estructura>::Cantidad();
+    string nombre = estructura;
+    if (hilos > 1) nombre += "/" + to_string(hilos) + "h";
+
+    auto t0 = Reloj::now();
+    size_t nuevos = Repartir(inserciones, hilos, [&e](const Type& x) { return Insertar(e, x); });
+    auto t1 = Reloj::now();
+
+    size_t encontrados = Repartir(busquedas, hilos, [&e](const Type& x) { return Buscar(e, x); });
+    auto t2 = Reloj::now();
+
+    rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+
+    auto fila = [&](const char* operacion, size_t exitos, Reloj::duration d) {
+        double ns = chrono::duration<double, nano>(d).count() / n;
+        printf("%s,%s,%d,%s,%s,%zu,%zu,%.1f,%.0f,%ld,%d\n", nombre.c_str(), Clave<Type>::Nombre(), grado,
+               Nombre(carga), operacion, n, exitos, ns, 1e9 / ns, static_cast<long>(uso.ru_maxrss), Altura(e));
+    };
+    fila("insercion", nuevos, t1 - t0);
+    fila("busqueda", encontrados, t2 - t1);
+}
+
+/**
+ * @brief Corre una medición en un proceso hijo para aislar su pico de memoria.
+ */
+template <typename Estructura, typename Type>
+static void Aislar(const char* estructura, int grado, Carga carga, size_t n) {
+    fflush(stdout);
+    pid_t hijo = fork();
+    if (hijo == 0) {
+        Medir<Estructura, Type>(estructura, grado, carga, n);
+        fflush(stdout);
+        _exit(0);
+    }
+    if (hijo < 0) {
+        Medir<Estructura, Type>(estructura, grado, carga, n); // Sin fork: el pico es acumulado
+        return;
+    }
+    int estado;
+    waitpid(hijo, &estado, 0);
+}
+
+template <typename Type>
+static void MedirTipo(size_t n) {
+    for (Carga carga : {Carga::Aleatoria, Carga::Secuencial, Carga::Zipf}) {
+        Aislar<set<Type>, Type>("std::set", 0, carga, n);
+        Aislar<StarBTree<Type, 4>, Type>("StarBTree", 4, carga, n);
+        Aislar<StarBTree<Type, 16>, Type>("StarBTree", 16, carga, n);
+        Aislar<StarBTree<Type, 64>, Type>("StarBTree", 64, carga, n);
+        Aislar<StarBTree<Type, 256>, Type>("StarBTree", 256, carga, n);
+
+        // Políticas de desborde (el vecino es el de las filas anteriores)
+        Aislar<StarBTree<Type, 64, TrazaNula, PoolNodos, less<Type>, false, DesbordeClasico>, Type>(
+            "StarBTree/clasico", 64, carga, n);
+        Aislar<StarBTree<Type, 64, TrazaNula, PoolNodos, less<Type>, false, DesbordeTriple>, Type>(
+            "StarBTree/triple", 64, carga, n);
+        Aislar<StarBTree<Type, 64, TrazaNula, PoolNodos, less<Type>, false, DesbordeCascada>, Type>(
+            "StarBTree/cascada", 64, carga, n);
+
+        // Lecturas optimistas: solo claves trivialmente copiables
+        if constexpr (is_trivially_copyable<Type>::value) {
+            Aislar<StarBTreeConcurrente<Type, 64>, Type>("StarBTreeConcurrente", 64, carga, n);
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], nullptr, 10) : 200000;
+    if (n < 2) n = 2;
+
+    printf("estructura,tipo,grado,carga,operacion,n,exitos,ns_op,ops_seg,rss_kb,altura\n");
+    MedirTipo<int32_t>(n);
+    MedirTipo<int64_t>(n);
+    MedirTipo<string>(n);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#ifndef ASIGNADORNODOS_HPP_INCLUDED
+#define ASIGNADORNODOS_HPP_INCLUDED
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @file AsignadorNodos.hpp
+ * @brief Políticas de asignación de memoria para los nodos del Árbol B*.
+ * @details El árbol recibe la política como parámetro de plantilla de plantilla y la
+ * instancia con su tipo de nodo. Una política debe ofrecer:
+ *  - Nodo* Crear(): construye un nodo vacío.
+ *  - void Destruir(Nodo*): destruye y libera un nodo.
+ *  - void LiberarTodo(): libera de una vez la memoria de todos los nodos.
+ *  - static constexpr bool liberacionMasiva: si LiberarTodo() libera sin recorrer los nodos.
+ *  - Constructor y asignación por movimiento que transfieran la propiedad de los nodos.
+ */
+
+/**
+ * @brief Política mínima: cada nodo se obtiene con new y se libera con delete.
+ */
+template <typename Nodo>
+struct AsignadorNew {
+    static constexpr bool liberacionMasiva = false;
+
+    Nodo* Crear() { return new Nodo(); }
+    void Destruir(Nodo* nodo) { delete nodo; }
+    void LiberarTodo() {}
+};
+
+/**
+ * @brief Pool de nodos de tamaño fijo organizado en bloques (slab).
+ *
+ * Los nodos se reservan por bloques contiguos; los nodos destruidos pasan a una lista
+ * libre y se reutilizan en las siguientes divisiones. LiberarTodo() devuelve toda la
+ * memoria en O(bloques). Cada árbol tiene su propio pool: copiar el asignador no
+ * comparte los bloques, y moverlo transfiere los bloques junto con los nodos vivos.
+ */
+template <typename Nodo>
+class PoolNodos {
+public:
+    static constexpr bool liberacionMasiva = true;
+
+    PoolNodos() : bloques(nullptr), libres(nullptr), usados(nodosPorBloque) {}
+    PoolNodos(const PoolNodos&) : PoolNodos() {}
+    PoolNodos& operator=(const PoolNodos&) { return *this; }
+    PoolNodos(PoolNodos&& c) noexcept : bloques(c.bloques), libres(c.libres), usados(c.usados) {
+        c.bloques = nullptr;
+        c.libres = nullptr;
+        c.usados = nodosPorBloque;
+    }
+    PoolNodos& operator=(PoolNodos&& c) noexcept {
+        if (this != &c) {
+            LiberarTodo();
+            bloques = c.bloques;
+            libres = c.libres;
+            usados = c.usados;
+            c.bloques = nullptr;
+            c.libres = nullptr;
+            c.usados = nodosPorBloque;
+        }
+        return *this;
+    }
+    ~PoolNodos() { LiberarTodo(); }
+
+    /**
+     * @brief Construye un nodo, reutilizando uno liberado si lo hay.
+     */
+    Nodo* Crear() {
+        Ranura* ranura;
+        if (libres != nullptr) {
+            ranura = libres;
+            libres = libres->siguiente;
+        } else {
+            if (usados == nodosPorBloque) NuevoBloque();
+            ranura = &bloques->ranuras[usados++];
+        }
+        return new (ranura->datos) Nodo();
+    }
+
+    /**
+     * @brief Destruye un nodo y deja su ranura en la lista libre.
+     */
+    void Destruir(Nodo* nodo) {
+        nodo->~Nodo();
+        Ranura* ranura = reinterpret_cast<Ranura*>(nodo);
+        ranura->siguiente = libres;
+        libres = ranura;
+    }
+
+    /**
+     * @brief Libera todos los bloques sin ejecutar destructores de los nodos vivos.
+     * @note Quien llama debe haber destruido los nodos si su tipo no es trivialmente destructible.
+     */
+    void LiberarTodo() {
+        while (bloques != nullptr) {
+            Bloque* siguiente = bloques->siguiente;
+            delete bloques;
+            bloques = siguiente;
+        }
+        libres = nullptr;
+        usados = nodosPorBloque;
+    }
+
+private:
+    union Ranura {
+        Ranura* siguiente;
+        alignas(Nodo) unsigned char datos[sizeof(Nodo)];
+    };
+
+    /// Alrededor de 64 KiB por bloque, con un mínimo de 16 nodos
+    static constexpr std::size_t nodosPorBloque =
+        (65536 / sizeof(Ranura) > 16) ? 65536 / sizeof(Ranura) : 16;
+
+    struct Bloque {
+        Bloque* siguiente;
+        Ranura ranuras[nodosPorBloque];
+    };
+
+    Bloque* bloques;       ///< Bloque actual al frente de la lista de bloques
+    Ranura* libres;        ///< Lista de ranuras liberadas
+    std::size_t usados;    ///< Ranuras entregadas del bloque actual
+
+    void NuevoBloque() {
+        Bloque* nuevo = new Bloque;
+        nuevo->siguiente = bloques;
+        bloques = nuevo;
+        usados = 0;
+    }
+};
+
+#endif // ASIGNADORNODOS_HPP_INCLUDED
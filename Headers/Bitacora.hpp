@@ -0,0 +1,75 @@
+#ifndef BITACORA_HPP_INCLUDED
+#define BITACORA_HPP_INCLUDED
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/// Operación guardada en la bitácora
+enum class Operacion : std::uint8_t {
+    Insercion = 1,
+    Eliminacion = 2
+};
+
+/**
+ * Bitácora de escritura anticipada (WAL) de solo agregado.
+ *
+ * Cada operación se guarda como { uint8 operacion; Type valor; uint32 suma }, donde suma
+ * es FNV-1a de los bytes anteriores del registro. Los registros se acumulan en memoria y
+ * se escriben juntos con una sola escritura secuencial y un fsync (confirmación en grupo)
+ * cuando se juntan operacionesPorGrupo o pasa intervalo desde la última confirmación. El
+ * intervalo se revisa al registrar: no hay hilo de fondo, así que Confirmar() fuerza la
+ * escritura cuando no llegan más operaciones.
+ *
+ * Al abrir, un registro incompleto o con suma incorrecta al final (escritura cortada por
+ * una caída) se descarta y el archivo se trunca ahí.
+ */
+template <typename Type>
+class Bitacora {
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "La bitácora guarda los valores byte a byte");
+public:
+    explicit Bitacora(const std::string& ruta, int operacionesPorGrupo = 64,
+                      std::chrono::milliseconds intervalo = std::chrono::milliseconds(10)); // Abre o crea el archivo
+    Bitacora(const Bitacora&) = delete;
+    Bitacora& operator=(const Bitacora&) = delete;
+    ~Bitacora(); // Confirma lo pendiente
+
+    void Registrar(Operacion operacion, const Type& valor); // Agrega la operación; confirma si toca. Si lanza, no quedó registrada
+    void Confirmar(); // Escribe lo pendiente y espera a que llegue al disco
+    void Truncar(); // Descarta todo (tras guardar una imagen que ya lo contiene)
+
+    template <typename Funcion>
+    std::size_t Reproducir(Funcion fn) const; // Llama fn(operacion, valor) por cada registro confirmado
+
+    std::size_t Pendientes() const { return pendientes; } // Registradas y aún no confirmadas
+    std::size_t Confirmaciones() const { return confirmaciones; } // Escrituras con fsync realizadas
+
+private:
+    static constexpr std::uint32_t firmaBitacora = 0x57544253; // "SBTW"
+    static constexpr std::uint32_t versionBitacora = 1;
+    static constexpr std::size_t tamCabecera = 16;
+    static constexpr std::size_t tamRegistro = 1 + sizeof(Type) + sizeof(std::uint32_t);
+
+    std::string ruta;
+    std::FILE* archivo;
+    long finValido; // Fin del último registro íntegro en el archivo
+    int operacionesPorGrupo;
+    std::chrono::milliseconds intervalo;
+    std::chrono::steady_clock::time_point ultimaConfirmacion;
+    std::vector<unsigned char> bufer; // Registros aún no escritos
+    std::size_t pendientes;
+    std::size_t confirmaciones;
+
+    static std::uint32_t Sumar(const unsigned char* datos, std::size_t tam);
+    void Abrir();
+    void Cortar(long tam); // Trunca el archivo a tam bytes y se ubica al final
+};
+
+#include "../Templates/Bitacora.tpp"
+
+#endif // BITACORA_HPP_INCLUDED
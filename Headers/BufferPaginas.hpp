@@ -0,0 +1,101 @@
+#ifndef BUFFERPAGINAS_HPP_INCLUDED
+#define BUFFERPAGINAS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Buffer de páginas de tamaño fijo guardadas en un archivo, con reemplazo CLOCK.
+ *
+ * El archivo es un arreglo de páginas: la página id ocupa los bytes
+ * [id * sizeof(Pagina), (id + 1) * sizeof(Pagina)). En memoria caben a lo sumo 'marcos'
+ * páginas; al pedir una que no está se desaloja la primera sin fijar que la manecilla
+ * encuentre sin el bit de referencia, escribiéndola antes si está sucia.
+ *
+ * Una página se usa a través de Fijada: mientras exista no se desaloja, y al destruirse
+ * se libera marcándola sucia si se llamó a Modificada().
+ *
+ * Sincronizar escribe las páginas sucias, espera a que lleguen al disco (fsync) y recién
+ * entonces escribe y sincroniza la página 0; ese es el único orden de escritura que se
+ * garantiza. Entre dos llamadas las páginas se sobrescriben en su lugar y el desalojo escribe
+ * cualquier página sucia, la 0 incluida (hasta recién creada), así que el archivo no queda
+ * consistente ante una caída entre dos Sincronizar.
+ */
+template <typename Pagina>
+class BufferPaginas {
+    static_assert(std::is_trivially_copyable<Pagina>::value,
+                  "Las páginas se escriben byte a byte en el archivo");
+public:
+    using IdPagina = std::uint32_t;
+
+    class Fijada; // Acceso a una página que no se desaloja mientras exista
+
+    BufferPaginas(const std::string& ruta, std::size_t marcos); // Abre o crea el archivo
+    BufferPaginas(const BufferPaginas&) = delete;
+    BufferPaginas& operator=(const BufferPaginas&) = delete;
+    ~BufferPaginas(); // Escribe las páginas sucias y cierra el archivo
+
+    Fijada Fijar(IdPagina id); // Carga la página si no está en memoria
+    Fijada Nueva(); // Agrega una página en cero al final del archivo
+    void Sincronizar(); // Escribe las páginas sucias (la 0 al final) y espera al disco
+
+    IdPagina CantPaginas() const { return cantPaginas; }
+    std::size_t Lecturas() const { return lecturas; } // Páginas leídas del archivo
+    std::size_t Escrituras() const { return escrituras; } // Páginas escritas al archivo
+
+    class Fijada {
+    public:
+        Fijada(Fijada&& c) noexcept : buffer(c.buffer), marco(c.marco), sucia(c.sucia) { c.buffer = nullptr; }
+        Fijada(const Fijada&) = delete;
+        Fijada& operator=(const Fijada&) = delete;
+        ~Fijada() { if (buffer != nullptr) buffer->Liberar(marco, sucia); }
+
+        Pagina& operator*() const { return buffer->marcos[marco].pagina; }
+        Pagina* operator->() const { return &buffer->marcos[marco].pagina; }
+        IdPagina Id() const { return buffer->marcos[marco].id; }
+        void Modificada() { sucia = true; } // La página se escribirá antes de desalojarse
+
+    private:
+        friend class BufferPaginas;
+
+        BufferPaginas* buffer;
+        std::size_t marco;
+        bool sucia;
+
+        Fijada(BufferPaginas* b, std::size_t m, bool s) : buffer(b), marco(m), sucia(s) {}
+    };
+
+private:
+    struct Marco {
+        Pagina pagina;
+        IdPagina id;
+        int fijaciones;
+        bool ocupado;
+        bool sucia;
+        bool referenciada; // Bit de CLOCK: se limpia en la primera pasada de la manecilla
+    };
+
+    std::string ruta;
+    std::FILE* archivo;
+    std::vector<Marco> marcos;
+    std::unordered_map<IdPagina, std::size_t> tabla; // Página -> marco que la contiene
+    std::size_t manecilla;
+    IdPagina cantPaginas;
+    std::size_t lecturas;
+    std::size_t escrituras;
+
+    std::size_t Victima();
+    void Liberar(std::size_t marco, bool sucia);
+    void Leer(IdPagina id, Pagina& pagina);
+    void Escribir(Marco& marco);
+    void Volcar(); // fflush y fsync del archivo
+};
+
+#include "../Templates/BufferPaginas.tpp"
+
+#endif // BUFFERPAGINAS_HPP_INCLUDED
@@ -0,0 +1,140 @@
+#ifndef BUSQUEDANODO_HPP_INCLUDED
+#define BUSQUEDANODO_HPP_INCLUDED
+
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @file BusquedaNodo.hpp
+ * @brief Búsqueda de la posición de una clave dentro de un nodo.
+ * @details La estrategia se elige en tiempo de compilación a partir de Type, grado y Compare:
+ *  - Claves aritméticas con el orden natural en nodos pequeños: conteo vectorial (AVX2/SSE)
+ *    de las claves menores, con un conteo escalar sin saltos como respaldo.
+ *  - Nodos grandes: búsqueda binaria sin saltos.
+ *  - Resto de los casos: recorrido lineal.
+ */
+
+template <typename Type, int grado, typename Compare = std::less<Type>>
+struct BusquedaNodo {
+    /// A partir de este grado la búsqueda binaria supera al conteo lineal
+    static constexpr int umbralBinaria = 64;
+
+    /// El conteo vectorial compara con '<' de la máquina: solo vale con el orden natural
+    static constexpr bool ordenNatural =
+        std::is_same<Compare, std::less<Type>>::value || std::is_same<Compare, std::less<>>::value;
+    static constexpr bool aritmetica =
+        std::is_arithmetic<Type>::value && !std::is_same<Type, bool>::value && ordenNatural;
+    static constexpr bool binaria = grado > umbralBinaria;
+
+    /**
+     * @brief Devuelve la posición de la primera clave que no es menor que valor.
+     * @param claves Arreglo ordenado de claves del nodo.
+     * @param n Cantidad de claves válidas.
+     * @param valor Valor buscado; puede ser de otro tipo si Compare es transparente.
+     * @param comparar Orden de las claves.
+     * @return Índice en [0, n]; coincide con el hijo por el que hay que descender.
+     */
+    template <typename K>
+    static int Posicion(const Type* claves, int n, const K& valor, const Compare& comparar = Compare()) {
+        if constexpr (binaria) {
+            return Binaria(claves, n, valor, comparar);
+        } else if constexpr (aritmetica && std::is_same<K, Type>::value) {
+            return Conteo(claves, n, valor);
+        } else {
+            int i = 0;
+            while (i < n && comparar(claves[i], valor)) ++i;
+            return i;
+        }
+    }
+
+private:
+    /**
+     * @brief Búsqueda binaria sin saltos: el cuerpo del ciclo solo usa movimientos condicionales.
+     */
+    template <typename K>
+    static int Binaria(const Type* claves, int n, const K& valor, const Compare& comparar) {
+        if (n == 0) return 0;
+        const Type* base = claves;
+        int restante = n;
+        while (restante > 1) {
+            int mitad = restante / 2;
+            base = comparar(base[mitad - 1], valor) ? base + mitad : base;
+            restante -= mitad;
+        }
+        return static_cast<int>(base - claves) + comparar(*base, valor);
+    }
+
+    /**
+     * @brief Cuenta las claves menores que valor; como el nodo está ordenado, es la posición buscada.
+     */
+    static int Conteo(const Type* claves, int n, const Type& valor) {
+        int i = 0;
+        int cuenta = 0;
+#if defined(__AVX2__)
+        if constexpr (std::is_same<Type, float>::value) {
+            const __m256 v = _mm256_set1_ps(valor);
+            for (; i + 8 <= n; i += 8) {
+                __m256 c = _mm256_cmp_ps(_mm256_loadu_ps(claves + i), v, _CMP_LT_OQ);
+                cuenta += __builtin_popcount(_mm256_movemask_ps(c));
+            }
+        } else if constexpr (std::is_same<Type, double>::value) {
+            const __m256d v = _mm256_set1_pd(valor);
+            for (; i + 4 <= n; i += 4) {
+                __m256d c = _mm256_cmp_pd(_mm256_loadu_pd(claves + i), v, _CMP_LT_OQ);
+                cuenta += __builtin_popcount(_mm256_movemask_pd(c));
+            }
+        } else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value && sizeof(Type) == 4) {
+            const __m256i v = _mm256_set1_epi32(static_cast<int32_t>(valor));
+            for (; i + 8 <= n; i += 8) {
+                __m256i c = _mm256_cmpgt_epi32(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(claves + i)));
+                cuenta += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(c)));
+            }
+        } else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value && sizeof(Type) == 8) {
+            const __m256i v = _mm256_set1_epi64x(static_cast<int64_t>(valor));
+            for (; i + 4 <= n; i += 4) {
+                __m256i c = _mm256_cmpgt_epi64(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(claves + i)));
+                cuenta += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(c)));
+            }
+        }
+#elif defined(__SSE2__)
+        if constexpr (std::is_same<Type, float>::value) {
+            const __m128 v = _mm_set1_ps(valor);
+            for (; i + 4 <= n; i += 4) {
+                cuenta += __builtin_popcount(_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(claves + i), v)));
+            }
+        } else if constexpr (std::is_same<Type, double>::value) {
+            const __m128d v = _mm_set1_pd(valor);
+            for (; i + 2 <= n; i += 2) {
+                cuenta += __builtin_popcount(_mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(claves + i), v)));
+            }
+        } else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value && sizeof(Type) == 4) {
+            const __m128i v = _mm_set1_epi32(static_cast<int32_t>(valor));
+            for (; i + 4 <= n; i += 4) {
+                __m128i c = _mm_cmplt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(claves + i)), v);
+                cuenta += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(c)));
+            }
+        }
+#if defined(__SSE4_2__)
+        else if constexpr (std::is_integral<Type>::value && std::is_signed<Type>::value && sizeof(Type) == 8) {
+            const __m128i v = _mm_set1_epi64x(static_cast<int64_t>(valor));
+            for (; i + 2 <= n; i += 2) {
+                __m128i c = _mm_cmpgt_epi64(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(claves + i)));
+                cuenta += __builtin_popcount(_mm_movemask_pd(_mm_castsi128_pd(c)));
+            }
+        }
+#endif
+#endif
+        // Respaldo escalar (y cola del vector): suma sin saltos dependientes de los datos
+        for (; i < n; ++i) {
+            cuenta += (claves[i] < valor);
+        }
+        return cuenta;
+    }
+};
+
+#endif // BUSQUEDANODO_HPP_INCLUDED
@@ -0,0 +1,62 @@
+#ifndef ESTADISTICASARBOL_HPP_INCLUDED
+#define ESTADISTICASARBOL_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file EstadisticasArbol.hpp
+ * @brief Forma, ocupación y contadores de reorganización de un Árbol B*.
+ * @details StarBTree::Estadisticas() recorre el árbol para la parte estructural y copia
+ * los contadores, que el árbol acumula en cada evento estructural desde que se construyó
+ * solo si su política de traza los lleva (TrazaContadores, TrazaConsola); con TrazaNula
+ * quedan en cero.
+ */
+
+/**
+ * @brief Contadores acumulados durante la vida del árbol (Vaciar no los reinicia).
+ */
+struct ContadoresArbol {
+    std::uint64_t inserciones = 0;               ///< Valores que bajaron para insertarse (nuevos o repetidos)
+    std::uint64_t descensos = 0;                 ///< Niveles internos bajados por esas inserciones
+    std::uint64_t redistribucionesIzquierda = 0; ///< Incluye los préstamos al eliminar
+    std::uint64_t redistribucionesDerecha = 0;   ///< Incluye los préstamos al eliminar
+    std::uint64_t divisionesTriples = 0;
+    std::uint64_t divisionesDobles = 0;
+    std::uint64_t divisionesRaiz = 0;
+    std::uint64_t fusiones = 0;
+    std::uint64_t contraccionesRaiz = 0;
+
+    // Costo de resolver los desbordes al insertar, según la política de desborde
+    std::uint64_t clavesMovidas = 0; ///< Claves escritas en otro nodo o en otra posición del mismo
+    std::uint64_t nodosTocados = 0;  ///< Nodos modificados o creados, padres incluidos
+};
+
+/**
+ * @brief Fotografía de la estructura del árbol en un instante.
+ */
+struct EstadisticasArbol {
+    static constexpr int cubetas = 10; ///< Cubetas del histograma de llenado
+
+    int altura = 0;
+    int elementos = 0;
+    std::vector<std::size_t> nodosPorNivel; ///< nodosPorNivel[0] es la raíz
+
+    /// Nodos fuera de la raíz por llenado (claves / (grado - 1)): la cubeta k cubre
+    /// [k / 10, (k + 1) / 10) y la última incluye los nodos llenos
+    std::array<std::size_t, cubetas> histogramaLlenado{};
+    double llenadoMedio = 0;    ///< Llenado medio de los nodos fuera de la raíz
+    std::size_t bytesNodos = 0; ///< Memoria de los nodos vivos (sin el sobrante del pool)
+
+    ContadoresArbol contadores;
+
+    /// Niveles internos bajados en promedio por cada valor insertado
+    double ProfundidadMediaDescenso() const {
+        return contadores.inserciones == 0 ? 0.0
+                                           : static_cast<double>(contadores.descensos) / contadores.inserciones;
+    }
+};
+
+#endif // ESTADISTICASARBOL_HPP_INCLUDED
@@ -0,0 +1,101 @@
+#ifndef GEOMETRIANODO_HPP_INCLUDED
+#define GEOMETRIANODO_HPP_INCLUDED
+
+#include <cstddef>
+
+/**
+ * @file GeometriaNodo.hpp
+ * @brief Cálculo en tiempo de compilación del grado de un nodo a partir de un tamaño en bytes.
+ * @details El nodo interno de StarBTree es { int elemNodo; bool hoja; Type claves[grado];
+ * Carga cargas[grado] (solo con carga); int conteo[grado + 1] (solo con conteos);
+ * Nodo* hijo[grado + 1]; }; las hojas no tienen conteos ni hijos. Dado un presupuesto (64
+ * para una línea de caché, 4096 para una página, etc.) se elige el mayor grado cuyo nodo
+ * interno cabe en él, y el nodo interno se alinea al presupuesto.
+ */
+
+/// Tamaño y alineación de la carga de cada clave; sin carga no ocupa lugar
+template <typename Carga>
+struct MedidaCarga {
+    static constexpr std::size_t tamano = sizeof(Carga);
+    static constexpr std::size_t alineacion = alignof(Carga);
+};
+template <>
+struct MedidaCarga<void> {
+    static constexpr std::size_t tamano = 0;
+    static constexpr std::size_t alineacion = 1;
+};
+
+/// Alineación natural del nodo interno: la de su miembro más exigente
+template <typename Type, typename Carga = void>
+constexpr std::size_t AlineacionNatural() {
+    std::size_t a = alignof(Type) > alignof(void*) ? alignof(Type) : alignof(void*);
+    return MedidaCarga<Carga>::alineacion > a ? MedidaCarga<Carga>::alineacion : a;
+}
+
+/**
+ * @brief Tamaño de un nodo interno de grado g con la misma disposición que StarBTree::Interno.
+ * @tparam Carga Dato asociado a cada clave (void si no hay).
+ * @param conteos Si el nodo guarda además el tamaño del subárbol de cada hijo.
+ */
+template <typename Type, typename Carga = void>
+constexpr std::size_t TamanoNodo(int g, bool conteos = false) {
+    auto redondear = [](std::size_t n, std::size_t a) { return (n + a - 1) / a * a; };
+    using Medida = MedidaCarga<Carga>;
+    std::size_t claves = redondear(sizeof(int) + sizeof(bool), alignof(Type));
+    std::size_t fin = claves + g * sizeof(Type);
+    if (Medida::tamano > 0) fin = redondear(fin, Medida::alineacion) + g * Medida::tamano;
+    if (conteos) fin = redondear(fin, alignof(int)) + (g + 1) * sizeof(int);
+    std::size_t hijos = redondear(fin, alignof(void*));
+    return redondear(hijos + (g + 1) * sizeof(void*), AlineacionNatural<Type, Carga>());
+}
+
+/**
+ * @brief Grado y alineación de un nodo de StarBTree que ocupa a lo sumo bytes.
+ * @tparam Type Tipo de las claves.
+ * @tparam bytes Tamaño objetivo del nodo; debe ser potencia de dos.
+ * @tparam conteos Si el árbol guarda conteos por hijo (ver StarBTree).
+ * @tparam Carga Dato asociado a cada clave (void si no hay).
+ */
+template <typename Type, std::size_t bytes, bool conteos = false, typename Carga = void>
+struct GeometriaNodo {
+    static_assert(bytes != 0 && (bytes & (bytes - 1)) == 0, "El tamaño del nodo debe ser potencia de dos");
+    static_assert(TamanoNodo<Type, Carga>(3, conteos) <= bytes, "El tamaño no alcanza para un nodo de grado 3");
+
+    /// Mayor grado cuyo nodo cabe en el presupuesto
+    static constexpr int grado = [] {
+        int g = 3;
+        while (TamanoNodo<Type, Carga>(g + 1, conteos) <= bytes) ++g;
+        return g;
+    }();
+
+    static constexpr std::size_t alineacion = bytes;
+};
+
+/**
+ * @brief Alineación del nodo de StarBTree para un grado dado.
+ * @details Si grado es exactamente el que produce GeometriaNodo para algún presupuesto entre
+ * 64 y 4096 bytes, el nodo se alinea a ese presupuesto (una línea de caché, varias, o una
+ * página). Con cualquier otro grado se conserva la alineación natural. Las hojas se alinean
+ * a lo sumo a una línea de caché para no rellenarlas hasta el tamaño del nodo interno. El
+ * arreglo de cargas cuenta en el tamaño, así que con carga el grado que llena un presupuesto
+ * es menor.
+ */
+template <typename Type, int grado, bool conteos = false, typename Carga = void>
+struct AlineacionNodo {
+    static constexpr std::size_t minimo = 64;   ///< Línea de caché
+    static constexpr std::size_t maximo = 4096; ///< Página
+
+    static constexpr std::size_t valor = [] {
+        std::size_t natural = AlineacionNatural<Type, Carga>();
+        std::size_t tamano = TamanoNodo<Type, Carga>(grado, conteos);
+        if (tamano > maximo) return natural;
+        std::size_t bytes = minimo;
+        while (tamano > bytes) bytes *= 2;
+        // Solo si el nodo llena su presupuesto: un grado más ya no cabría
+        return TamanoNodo<Type, Carga>(grado + 1, conteos) > bytes ? bytes : natural;
+    }();
+
+    static constexpr std::size_t valorHoja = valor > minimo ? minimo : valor;
+};
+
+#endif // GEOMETRIANODO_HPP_INCLUDED
@@ -0,0 +1,172 @@
+#ifndef HOJACOMPRIMIDA_HPP_INCLUDED
+#define HOJACOMPRIMIDA_HPP_INCLUDED
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @file HojaComprimida.hpp
+ * @brief Codificación de claves enteras ordenadas como base más desplazamientos empaquetados.
+ * @details La base es la primera (menor) clave; cada clave se guarda como su distancia a la
+ * base con el menor ancho en bytes (1, 2, 4 u 8) que alcanza para la última. Con carriles de
+ * ancho fijo la búsqueda cuenta desplazamientos menores con SSE2 sin decodificar la hoja:
+ * 16 claves por instrucción con 1 byte, 8 con 2 bytes, 4 con 4 bytes.
+ */
+
+template <typename Type>
+struct HojaComprimida {
+    static_assert(std::is_integral<Type>::value && !std::is_same<Type, bool>::value,
+                  "La compresión por desplazamientos requiere claves enteras");
+
+    using SinSigno = typename std::make_unsigned<Type>::type;
+
+    /**
+     * @brief Devuelve el ancho en bytes de los desplazamientos para claves ordenadas.
+     * @param claves Claves en orden ascendente.
+     * @param n Cantidad de claves.
+     */
+    static int Ancho(const Type* claves, int n) {
+        if (n == 0) return 1;
+        std::uint64_t rango = Distancia(claves[0], claves[n - 1]);
+        if (rango <= 0xFFu) return 1;
+        if (rango <= 0xFFFFu) return 2;
+        if (rango <= 0xFFFFFFFFu) return 4;
+        return 8;
+    }
+
+    /**
+     * @brief Escribe los desplazamientos de las claves respecto de claves[0].
+     * @param datos Destino con al menos n * ancho bytes.
+     */
+    static void Empaquetar(const Type* claves, int n, int ancho, unsigned char* datos) {
+        switch (ancho) {
+            case 1: Empaquetar<std::uint8_t>(claves, n, datos); break;
+            case 2: Empaquetar<std::uint16_t>(claves, n, datos); break;
+            case 4: Empaquetar<std::uint32_t>(claves, n, datos); break;
+            default: Empaquetar<std::uint64_t>(claves, n, datos); break;
+        }
+    }
+
+    /**
+     * @brief Reconstruye las claves [desde, n) a partir de la base y los desplazamientos.
+     * @param salida Destino de n - desde claves.
+     */
+    static void Desempaquetar(Type base, int ancho, const unsigned char* datos, int desde, int n, Type* salida) {
+        switch (ancho) {
+            case 1: Desempaquetar<std::uint8_t>(base, datos, desde, n, salida); break;
+            case 2: Desempaquetar<std::uint16_t>(base, datos, desde, n, salida); break;
+            case 4: Desempaquetar<std::uint32_t>(base, datos, desde, n, salida); break;
+            default: Desempaquetar<std::uint64_t>(base, datos, desde, n, salida); break;
+        }
+    }
+
+    /**
+     * @brief Devuelve la i-ésima clave sin decodificar las demás.
+     */
+    static Type Leer(Type base, int ancho, const unsigned char* datos, int i) {
+        switch (ancho) {
+            case 1: return Sumar(base, Carril<std::uint8_t>(datos, i));
+            case 2: return Sumar(base, Carril<std::uint16_t>(datos, i));
+            case 4: return Sumar(base, Carril<std::uint32_t>(datos, i));
+            default: return Sumar(base, Carril<std::uint64_t>(datos, i));
+        }
+    }
+
+    /**
+     * @brief Devuelve la posición de la primera clave que no es menor que valor.
+     * @return Índice en [0, n].
+     */
+    static int Posicion(Type base, int ancho, const unsigned char* datos, int n, Type valor) {
+        if (n == 0 || valor <= base) return 0;
+        SinSigno d = Distancia(base, valor);
+        // Más allá del ancho de la hoja: mayor que todas sus claves
+        if (ancho < static_cast<int>(sizeof(SinSigno)) && (d >> (8 * ancho)) != 0) return n;
+
+        switch (ancho) {
+            case 1: return Conteo<std::uint8_t>(datos, n, static_cast<std::uint8_t>(d));
+            case 2: return Conteo<std::uint16_t>(datos, n, static_cast<std::uint16_t>(d));
+            case 4: return Conteo<std::uint32_t>(datos, n, static_cast<std::uint32_t>(d));
+            default: return Conteo<std::uint64_t>(datos, n, static_cast<std::uint64_t>(d));
+        }
+    }
+
+private:
+    /// Distancia hasta (>= desde) en aritmética sin signo, sin desbordar con signo
+    static SinSigno Distancia(Type desde, Type hasta) {
+        return static_cast<SinSigno>(static_cast<SinSigno>(hasta) - static_cast<SinSigno>(desde));
+    }
+
+    template <typename C>
+    static Type Sumar(Type base, C desplazamiento) {
+        return static_cast<Type>(static_cast<SinSigno>(static_cast<SinSigno>(base) + static_cast<SinSigno>(desplazamiento)));
+    }
+
+    template <typename C>
+    static C Carril(const unsigned char* datos, int i) {
+        C valor;
+        std::memcpy(&valor, datos + i * sizeof(C), sizeof(C));
+        return valor;
+    }
+
+    template <typename C>
+    static void Empaquetar(const Type* claves, int n, unsigned char* datos) {
+        for (int i = 0; i < n; ++i) {
+            C valor = static_cast<C>(Distancia(claves[0], claves[i]));
+            std::memcpy(datos + i * sizeof(C), &valor, sizeof(C));
+        }
+    }
+
+    template <typename C>
+    static void Desempaquetar(Type base, const unsigned char* datos, int desde, int n, Type* salida) {
+        for (int i = desde; i < n; ++i) {
+            *salida++ = Sumar(base, Carril<C>(datos, i));
+        }
+    }
+
+    /**
+     * @brief Cuenta los desplazamientos menores que d; como están ordenados, es la posición.
+     * @details SSE2 solo compara con signo: se invierte el bit alto de ambos lados.
+     */
+    template <typename C>
+    static int Conteo(const unsigned char* datos, int n, C d) {
+        int i = 0;
+        int cuenta = 0;
+#if defined(__SSE2__)
+        if constexpr (sizeof(C) == 1) {
+            const __m128i signo = _mm_set1_epi8(static_cast<char>(0x80));
+            const __m128i v = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(d)), signo);
+            for (; i + 16 <= n; i += 16) {
+                __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + i)), signo);
+                cuenta += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(x, v)));
+            }
+        } else if constexpr (sizeof(C) == 2) {
+            const __m128i signo = _mm_set1_epi16(static_cast<short>(0x8000));
+            const __m128i v = _mm_xor_si128(_mm_set1_epi16(static_cast<short>(d)), signo);
+            for (; i + 8 <= n; i += 8) {
+                __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + 2 * i)), signo);
+                // Cada carril de 16 bits aporta dos bits a la máscara
+                cuenta += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi16(x, v))) / 2;
+            }
+        } else if constexpr (sizeof(C) == 4) {
+            const __m128i signo = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            const __m128i v = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(d)), signo);
+            for (; i + 4 <= n; i += 4) {
+                __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(datos + 4 * i)), signo);
+                cuenta += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, v))));
+            }
+        }
+#endif
+        // Respaldo escalar (y cola del vector): suma sin saltos dependientes de los datos
+        for (; i < n; ++i) {
+            cuenta += (Carril<C>(datos, i) < d);
+        }
+        return cuenta;
+    }
+};
+
+#endif // HOJACOMPRIMIDA_HPP_INCLUDED
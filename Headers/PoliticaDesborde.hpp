@@ -0,0 +1,55 @@
+#ifndef POLITICADESBORDE_HPP_INCLUDED
+#define POLITICADESBORDE_HPP_INCLUDED
+
+/**
+ * @file PoliticaDesborde.hpp
+ * @brief Políticas de desborde: qué hace el Árbol B* cuando un hijo se llena al insertar.
+ * @details El árbol recibe la política como parámetro de plantilla y decide en tiempo de
+ * compilación. Una política combina dos decisiones:
+ *  - Redistribucion: si antes de dividir se intenta pasar claves a los hermanos, y a cuáles.
+ *  - Division: si el hijo se parte en dos (Árbol B clásico) o junto con un hermano en tres (B*).
+ *
+ * Dividir sin redistribuir toca menos nodos por inserción pero deja nodos a medio llenar;
+ * redistribuir en cascada llena más los nodos (árbol más bajo, menos memoria) a costa de
+ * mover más claves. Los contadores clavesMovidas y nodosTocados de StarBTree::Estadisticas()
+ * (con TrazaContadores) miden ese costo para cada carga.
+ *
+ * Con grado 64 y un millón de enteros aleatorios, el vecino llena los nodos al 88% moviendo
+ * unas 13 claves por inserción; la cascada llega al 99% pero mueve unas 1250 e inserta a
+ * menos de la mitad de velocidad. Por eso el vecino es la política por defecto.
+ */
+
+/**
+ * @brief Hermanos que reciben claves de un hijo lleno antes de dividirlo.
+ */
+enum class Redistribucion {
+    Ninguna, ///< Se divide enseguida
+    Vecino,  ///< Con un hermano adyacente con lugar, parejando ambos de una vez
+    Cascada  ///< Con el hermano más cercano con lugar, de a una clave a través de los intermedios
+};
+
+/**
+ * @brief Forma de dividir un hijo lleno cuando no se pudo redistribuir.
+ */
+enum class Division {
+    Doble, ///< El hijo se parte en dos mitades
+    Triple ///< El hijo y un hermano adyacente lleno se reparten en tres nodos
+};
+
+template <Redistribucion r, Division d>
+struct PoliticaDesborde {
+    static constexpr Redistribucion redistribucion = r;
+    static constexpr Division division = d;
+};
+
+/// Árbol B clásico: máxima velocidad de inserción, nodos llenos a la mitad tras dividir
+using DesbordeClasico = PoliticaDesborde<Redistribucion::Ninguna, Division::Doble>;
+/// B* sin redistribuir: divide en tres con el hermano adyacente más lleno solo si también
+/// está lleno (tres nodos a dos tercios); si no, divide en dos como el clásico
+using DesbordeTriple = PoliticaDesborde<Redistribucion::Ninguna, Division::Triple>;
+/// B* que solo reparte con un hermano adyacente, en un único movimiento (por defecto)
+using DesbordeVecino = PoliticaDesborde<Redistribucion::Vecino, Division::Triple>;
+/// B* con redistribución en cascada: el mayor llenado, la inserción más cara
+using DesbordeCascada = PoliticaDesborde<Redistribucion::Cascada, Division::Triple>;
+
+#endif // POLITICADESBORDE_HPP_INCLUDED
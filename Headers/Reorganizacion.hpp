@@ -0,0 +1,142 @@
+#ifndef REORGANIZACION_HPP_INCLUDED
+#define REORGANIZACION_HPP_INCLUDED
+
+#include "PoliticaDesborde.hpp"
+
+/**
+ * @file Reorganizacion.hpp
+ * @brief Decisiones y aritmética de reparto comunes a las variantes del Árbol B*.
+ * @details Qué hermano recibe o presta claves, cuándo dividir en dos o en tres, qué
+ * hermanos fusionar y cuántas claves queda en cada nodo no depende de cómo guarda cada
+ * variante sus claves. StarBTree, StarBPlusTree, StarBTreePaginado y StarBTreeConcurrente
+ * piden aquí un Plan y lo ejecutan con sus propias primitivas (rotar, parejar, dividir,
+ * fusionar), que sí dependen del formato de sus nodos. StarBTreeCadenas y StarBTreeEnteros recodifican entero cada
+ * nodo que tocan, así que ejecutan cualquier plan como un único reparto de los hijos que
+ * indica Afectados.
+ */
+struct Reorganizacion {
+    enum class Accion {
+        Ninguna,        ///< No hay nada que hacer (p. ej. los dos hijos de la raíz no caben juntos)
+        Cascada,        ///< Una clave viaja entre el hijo e indice, rotando por los intermedios
+        Nivelar,        ///< Parejar hijo[indice] e hijo[indice + 1]
+        DividirTriple,  ///< hijo[indice] e hijo[indice + 1] se reparten en tres
+        DividirDoble,   ///< hijo[indice] se parte en dos
+        FusionarTriple, ///< hijo[indice .. indice + 2] se reparten en dos
+        FusionarDoble   ///< hijo[0] e hijo[1] se juntan en uno
+    };
+
+    struct Plan {
+        Accion accion;
+        int indice; ///< Hermano de la cascada, o primer hijo afectado en las demás acciones
+    };
+
+    struct Tercios {
+        int a, b, c;
+    };
+
+    /// Hijos consecutivos que toca un plan y cuántos quedan en su lugar
+    struct Tramo {
+        int desde, cuantos, nuevos;
+    };
+
+    /// Mínimo de claves fuera de la raíz para nodos de hasta grado - 1 claves (dos tercios)
+    static constexpr int MinClaves(int grado) { return (2 * (grado - 1)) / 3; }
+
+    /// Reparte n claves en tres nodos lo más parejo posible; el último recibe el resto
+    static constexpr Tercios Triple(int n) {
+        return Tercios{n / 3, (n - n / 3) / 2, n - n / 3 - (n - n / 3) / 2};
+    }
+
+    /// Claves que quedan en el izquierdo al partir n en dos; el derecho recibe el resto
+    static constexpr int Mitad(int n) { return n / 2; }
+
+    /// Claves del nodo j al repartir n en k nodos; coincide con Mitad (k = 2) y Triple (k = 3)
+    static constexpr int Parte(int n, int k, int j) { return n * (j + 1) / k - n * j / k; }
+
+    /**
+     * @brief Traduce un plan a un reparto: las claves de hijo[desde .. desde + cuantos - 1] y
+     * sus separadoras se reparten en nuevos hijos con nuevos - 1 separadoras.
+     * @details Una cascada se traduce en parejar todo el tramo entre el hijo y el hermano.
+     * @param plan Plan devuelto por Desbordar o Subflujo.
+     * @param indiceHijo Hijo para el que se pidió el plan.
+     * @return Tramo vacío (cuantos == 0) si no hay nada que hacer.
+     */
+    static Tramo Afectados(Plan plan, int indiceHijo) {
+        switch (plan.accion) {
+            case Accion::Cascada:
+                return plan.indice < indiceHijo ? Tramo{plan.indice, indiceHijo - plan.indice + 1, indiceHijo - plan.indice + 1}
+                                                : Tramo{indiceHijo, plan.indice - indiceHijo + 1, plan.indice - indiceHijo + 1};
+            case Accion::Nivelar: return Tramo{plan.indice, 2, 2};
+            case Accion::DividirTriple: return Tramo{plan.indice, 2, 3};
+            case Accion::DividirDoble: return Tramo{plan.indice, 1, 2};
+            case Accion::FusionarTriple: return Tramo{plan.indice, 3, 2};
+            case Accion::FusionarDoble: return Tramo{0, 2, 1};
+            default: return Tramo{0, 0, 0};
+        }
+    }
+
+    /**
+     * @brief Decide qué hacer con un hijo que llegó a grado claves al insertar.
+     * @tparam Desborde Política de desborde (ver PoliticaDesborde).
+     * @param indiceHijo Hijo lleno.
+     * @param ultimo Índice del último hijo del padre (claves del padre).
+     * @param grado Capacidad de los nodos de ese nivel.
+     * @param claves claves(i) devuelve cuántas claves tiene hijo[i].
+     */
+    template <typename Desborde, typename Claves>
+    static Plan Desbordar(int indiceHijo, int ultimo, int grado, Claves claves) {
+        if constexpr (Desborde::redistribucion == Redistribucion::Cascada) {
+            for (int i = indiceHijo - 1; i >= 0; --i) {
+                if (claves(i) < grado - 1) return Plan{Accion::Cascada, i};
+            }
+            for (int i = indiceHijo + 1; i <= ultimo; ++i) {
+                if (claves(i) < grado - 1) return Plan{Accion::Cascada, i};
+            }
+        } else if constexpr (Desborde::redistribucion == Redistribucion::Vecino) {
+            if (indiceHijo > 0 && claves(indiceHijo - 1) < grado - 1) return Plan{Accion::Nivelar, indiceHijo - 1};
+            if (indiceHijo < ultimo && claves(indiceHijo + 1) < grado - 1) return Plan{Accion::Nivelar, indiceHijo};
+        }
+
+        if constexpr (Desborde::division == Division::Triple) {
+            // Con el hermano adyacente más lleno (el izquierdo si empatan). Tras redistribuir
+            // ambos están llenos; sin redistribución, un hermano con lugar se dividiría en
+            // tres nodos por debajo de dos tercios, así que entonces se divide en dos
+            bool izquierdo = indiceHijo > 0 && (indiceHijo == ultimo || claves(indiceHijo - 1) >= claves(indiceHijo + 1));
+            int hermano = izquierdo ? indiceHijo - 1 : indiceHijo + 1;
+            if (claves(hermano) >= grado - 1) return Plan{Accion::DividirTriple, izquierdo ? hermano : indiceHijo};
+        }
+        return Plan{Accion::DividirDoble, indiceHijo};
+    }
+
+    /**
+     * @brief Decide cómo corregir un hijo que quedó con menos de MinClaves(grado) claves.
+     *
+     * Primero un préstamo en cascada desde el hermano más cercano con claves de sobra
+     * (izquierda antes que derecha); si no hay, fusión de tres hermanos en dos, o de los
+     * dos únicos hijos en uno si caben.
+     *
+     * @param bajaSeparadora Si la separadora del padre entra al nodo fusionado (falso en
+     *        las hojas de un B*+, donde la separadora es una copia).
+     */
+    template <typename Claves>
+    static Plan Subflujo(int indiceHijo, int ultimo, int grado, Claves claves, bool bajaSeparadora = true) {
+        const int minimo = MinClaves(grado);
+        for (int i = indiceHijo - 1; i >= 0; --i) {
+            if (claves(i) > minimo) return Plan{Accion::Cascada, i};
+        }
+        for (int i = indiceHijo + 1; i <= ultimo; ++i) {
+            if (claves(i) > minimo) return Plan{Accion::Cascada, i};
+        }
+
+        if (ultimo >= 2) {
+            int inicio = indiceHijo - 1;
+            if (inicio < 0) inicio = 0;
+            if (inicio > ultimo - 2) inicio = ultimo - 2;
+            return Plan{Accion::FusionarTriple, inicio};
+        }
+        if (claves(0) + claves(1) + (bajaSeparadora ? 1 : 0) <= grado - 1) return Plan{Accion::FusionarDoble, 0};
+        return Plan{Accion::Ninguna, -1};
+    }
+};
+
+#endif // REORGANIZACION_HPP_INCLUDED
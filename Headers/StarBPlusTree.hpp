@@ -0,0 +1,173 @@
+#ifndef STARBPLUSTREE_HPP_INCLUDED
+#define STARBPLUSTREE_HPP_INCLUDED
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "StarBTreeTraza.hpp"
+#include "BusquedaNodo.hpp"
+#include "AsignadorNodos.hpp"
+#include "PoliticaDesborde.hpp"
+#include "Reorganizacion.hpp"
+
+/**
+ * Variante B*+ del árbol: los datos viven solo en las hojas, enlazadas con sus
+ * hermanas, y los nodos internos guardan únicamente separadoras. Compare y Desborde
+ * cumplen el mismo papel que en StarBTree: el orden de las claves y cómo se resuelve un
+ * hijo lleno (ver PoliticaDesborde).
+ */
+template <typename Type, int grado, typename Traza = TrazaNula,
+          template <typename> class Asignador = PoolNodos, typename Compare = std::less<Type>,
+          typename Desborde = DesbordeVecino>
+class StarBPlusTree {
+    static_assert(grado >= 3, "La división triple requiere grado >= 3");
+private:
+    struct Nodo;
+    struct Interno;
+    struct Hoja;
+public:
+    class const_iterator; // Iterador bidireccional sobre la lista de hojas
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    explicit StarBPlusTree(const Compare& comparar = Compare()); // Constructor por defecto
+    StarBPlusTree(const StarBPlusTree &c); // Constructor de copia
+    ~StarBPlusTree(); // Destructor
+    StarBPlusTree& operator=(const StarBPlusTree &c); // Operador asignación
+
+    void Agregar(Type valor); // Agrega un nuevo elemento
+    bool Insertar(Type valor); // Agrega y devuelve si el elemento no existía
+    bool Eliminar(const Type& valor); // Elimina el elemento con este valor; devuelve si existía
+
+    bool Buscar(const Type& valor) const; // Busca un elemento en el árbol
+    int CantElem() const; // Devuelve la cantidad de elementos actuales
+
+    void Vaciar(); // Vacía el árbol
+
+    // Recorridos y consultas por rango (cualquier modificación invalida los iteradores)
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+    const_iterator lower_bound(const Type& valor) const; // Primer elemento >= valor
+    const_iterator upper_bound(const Type& valor) const; // Primer elemento > valor
+    std::pair<const_iterator, const_iterator> equal_range(const Type& valor) const;
+    template <typename Funcion>
+    void RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const; // Visita [desde, hasta] en orden
+
+    // Métodos de impresión
+    void ImprimirAsc() const;
+    void ImprimirDes() const;
+    void ImprimirNiveles() const;
+
+    Traza& ObtenerTraza(); // Acceso a la política de traza
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        const_iterator() : arbol(nullptr), hoja(nullptr), indice(0) {}
+
+        reference operator*() const { return hoja->claves[indice]; }
+        pointer operator->() const { return &hoja->claves[indice]; }
+
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int) { const_iterator previo(*this); ++*this; return previo; }
+        const_iterator operator--(int) { const_iterator previo(*this); --*this; return previo; }
+
+        bool operator==(const const_iterator& c) const { return hoja == c.hoja && indice == c.indice; }
+        bool operator!=(const const_iterator& c) const { return !(*this == c); }
+
+    private:
+        friend class StarBPlusTree;
+
+        const StarBPlusTree* arbol;
+        const Hoja* hoja; ///< nullptr representa end()
+        int indice;
+
+        const_iterator(const StarBPlusTree* a, const Hoja* h, int i) : arbol(a), hoja(h), indice(i) {}
+    };
+
+private:
+    int cantElem;
+    Traza traza;
+
+    struct Nodo {
+        int elemNodo;
+        bool hoja;
+        Type claves[grado];
+
+        explicit Nodo(bool esHoja) : elemNodo(0), hoja(esHoja) {}
+    };
+
+    struct Interno : Nodo {
+        Nodo* hijo[grado + 1];
+
+        Interno() : Nodo(false) {
+            for(int i = 0; i <= grado; ++i) {
+                hijo[i] = nullptr;
+            }
+        }
+    };
+
+    struct Hoja : Nodo {
+        Hoja* anterior;
+        Hoja* siguiente;
+
+        Hoja() : Nodo(true), anterior(nullptr), siguiente(nullptr) {}
+    };
+
+    Asignador<Interno> asignadorInterno; // Política de memoria de los nodos internos
+    Asignador<Hoja> asignadorHoja;       // Política de memoria de las hojas
+    Nodo* raiz;
+    Compare comparar; // Orden de las claves
+
+    using Busqueda = BusquedaNodo<Type, grado, Compare>; // Estrategia de búsqueda dentro del nodo
+
+    static constexpr int minClaves = Reorganizacion::MinClaves(grado); // Mínimo de claves fuera de la raíz
+
+    static Interno* ComoInterno(Nodo* nodo) { return static_cast<Interno*>(nodo); }
+    static const Interno* ComoInterno(const Nodo* nodo) { return static_cast<const Interno*>(nodo); }
+    static Hoja* ComoHoja(Nodo* nodo) { return static_cast<Hoja*>(nodo); }
+    static const Hoja* ComoHoja(const Nodo* nodo) { return static_cast<const Hoja*>(nodo); }
+    static void Mover(Nodo* destino, int i, Nodo* origen, int j) { destino->claves[i] = std::move(origen->claves[j]); }
+
+    // Métodos auxiliares privados
+    Nodo* CopiarArbol(const Nodo* subraiz, Hoja*& previa);
+    bool Agregar(Type& valor, Nodo* subraiz); // Mueve valor a la hoja solo si se inserta
+    bool Eliminar(const Type& valor, Nodo* subraiz);
+    void Vaciar(Nodo* nodo);
+    void Destruir(Nodo* nodo);
+    int IndiceHijo(const Interno* nodo, const Type& valor) const;
+    const Hoja* BuscarHoja(const Type& valor) const;
+    const Hoja* PrimeraHoja() const;
+    const Hoja* UltimaHoja() const;
+
+    // Complementos para Agregar y Eliminar
+    void OrdenarNodo(Interno* padre, int indiceHijo);
+    void Redistribuir(Interno* padre, int indiceHijo, int hermano);
+    void RedistribuirVecino(Interno* padre, int indiceHijo, int indice);
+    void Nivelar(Interno* padre, int indice); // Parejo entre hijo[indice] e hijo[indice + 1]
+    void RotarIzquierda(Interno* padre, int indice);
+    void RotarDerecha(Interno* padre, int indice);
+    void DividirTriple(Interno* padre, int indiceHijo, int posFusion);
+    void DividirDoble(Interno* padre, int indiceHijo);
+    Nodo* PartirMitad(Nodo* nodo); // Mitad derecha a un nodo nuevo; la separadora queda tras las claves del original
+    void DividirRaiz();
+    void CorregirSubflujo(Interno* padre, int indiceHijo);
+    void FusionarTriple(Interno* padre, int inicio);
+    void FusionarDoble(Interno* padre);
+    void Notificar(TipoEvento tipo, int indiceHijo, int indiceHermano = -1);
+};
+
+#include "../Templates/StarBPlusTree.tpp"
+
+#endif // STARBPLUSTREE_HPP_INCLUDED
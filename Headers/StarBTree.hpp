@@ -1,60 +1,378 @@
 #ifndef STARBTREE_HPP_INCLUDED
 #define STARBTREE_HPP_INCLUDED
 
-template <typename Type, int grado>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include "StarBTreeTraza.hpp"
+#include "BusquedaNodo.hpp"
+#include "AsignadorNodos.hpp"
+#include "GeometriaNodo.hpp"
+#include "StarBTreeImagen.hpp"
+#include "EstadisticasArbol.hpp"
+#include "PoliticaDesborde.hpp"
+#include "Reorganizacion.hpp"
+
+/**
+ * Árbol B* en memoria.
+ *
+ * Con conteos = true cada nodo interno guarda además cuántos elementos tiene el subárbol
+ * de cada hijo, y el árbol responde Rango, Seleccionar, ContarRango y Percentil en
+ * O(grado · altura) sin recorrerse en orden. Cada nodo interno ocupa grado + 1 enteros más.
+ *
+ * Desborde elige cómo se resuelve un hijo lleno al insertar (ver PoliticaDesborde): dividir
+ * en dos como un Árbol B, o redistribuir con los hermanos y dividir dos nodos en tres.
+ *
+ * Con una Carga distinta de void cada clave lleva un dato asociado, guardado en un arreglo
+ * paralelo a las claves que la búsqueda no recorre; la carga viaja con su clave en cada
+ * reorganización. const_iterator::carga() la lee; para modificarla hace falta un iterator,
+ * que devuelven Colocar y Modificable (ver StarBTreeMap).
+ */
+template <typename Type, int grado, typename Traza = TrazaNula,
+          template <typename> class Asignador = PoolNodos, typename Compare = std::less<Type>,
+          bool conteos = false, typename Desborde = DesbordeVecino, typename Carga = void>
 class StarBTree {
+    static_assert(grado >= 3, "La división triple requiere grado >= 3");
+private:
+    struct Nodo;
+    struct Interno;
+    struct Hoja;
 public:
-    explicit StarBTree(); // Constructor por defecto
+    class const_iterator; // Iterador bidireccional en orden (solo lectura)
+    class iterator; // Como const_iterator, con la carga modificable
+    class Instantanea; // Vista de solo lectura del árbol en un instante dado
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    explicit StarBTree(const Compare& comparar = Compare()); // Constructor por defecto
     StarBTree(const StarBTree &c); // Constructor de copia
+    StarBTree(StarBTree &&c) noexcept; // Constructor por movimiento
+    template <typename Iterador>
+    StarBTree(Iterador inicio, Iterador fin, double llenado = 1.0); // Carga masiva ordenada
     ~StarBTree(); // Destructor
     StarBTree& operator=(const StarBTree &c); // Operador asignación
+    StarBTree& operator=(StarBTree &&c) noexcept; // Asignación por movimiento
 
     void Agregar(Type valor); // Agrega un nuevo elemento
-    //void Eliminar(Type valor); // Elimina el primer elemento con este valor
+    bool Insertar(Type valor); // Agrega y devuelve si el elemento no existía
+    template <typename... Args>
+    bool Emplazar(Args&&... args); // Construye el elemento con args y lo inserta moviéndolo
+    template <typename... Args>
+    std::pair<iterator, bool> Colocar(const Type& clave, Args&&... args); // Ubica la clave; si no estaba, la inserta con Carga(args...)
+    iterator Modificable(const_iterator it); // La misma posición de este árbol, con la carga modificable
+    template <typename Iterador>
+    int InsertarLote(Iterador inicio, Iterador fin, bool ordenado = false); // Inserta varios con un descenso compartido; devuelve cuántos eran nuevos
+    bool Eliminar(const Type& valor); // Elimina el elemento con este valor; devuelve si existía
 
-    bool Buscar(Type valor) const; // Busca un elemento en el árbol
+    bool Buscar(const Type& valor) const; // Busca un elemento en el árbol
+    template <typename K, typename C = Compare, typename = typename C::is_transparent>
+    bool Buscar(const K& valor) const; // Búsqueda heterogénea (p. ej. std::string_view con std::less<>)
+    template <typename Iterador, typename Salida>
+    int BuscarLote(Iterador inicio, Iterador fin, Salida resultados) const; // Un bool por clave en resultados; devuelve cuántas están
     int CantElem() const; // Devuelve la cantidad de elementos actuales
+    int Altura() const; // Niveles del árbol (0 si está vacío)
+
+    // Estadísticos de orden (solo con conteos = true)
+    int Rango(const Type& valor) const; // Cantidad de elementos menores que valor
+    const Type& Seleccionar(int k) const; // k-ésimo menor elemento, desde 0
+    int ContarRango(const Type& desde, const Type& hasta) const; // Elementos en [desde, hasta]
+    const Type& Percentil(double p) const; // Elemento en la posición p (0 a 1) del orden
+    EstadisticasArbol Estadisticas() const; // Altura, nodos por nivel, llenado, memoria y contadores (ver TrazaContadores)
+
+    template <typename Iterador>
+    void CargarOrdenado(Iterador inicio, Iterador fin, double llenado = 1.0); // Reemplaza el contenido en O(n)
 
     void Vaciar(); // Vacía el árbol
 
+    void Guardar(const std::string& ruta) const; // Imagen binaria con suma de verificación (se abre con StarBTreeImagen)
+
+    // Recorridos y consultas por rango (cualquier modificación invalida los iteradores)
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+    const_iterator lower_bound(const Type& valor) const; // Primer elemento >= valor
+    const_iterator upper_bound(const Type& valor) const; // Primer elemento > valor
+    std::pair<const_iterator, const_iterator> equal_range(const Type& valor) const;
+    template <typename Funcion>
+    void RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const; // Visita [desde, hasta] en orden
+
     // Métodos de impresión
     void ImprimirAsc() const;
     void ImprimirDes() const;
     void ImprimirNiveles() const;
 
+    Traza& ObtenerTraza(); // Acceso a la política de traza
+
+    // Instantáneas con copia en escritura; deben liberarse antes de destruir o mover el árbol
+    Instantanea TomarInstantanea(); // O(1): comparte los nodos hasta que el árbol los modifique
+
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        const_iterator() : raizArbol(nullptr), profundidad(0) {}
+        const_iterator(const const_iterator& c);
+        const_iterator& operator=(const const_iterator& c);
+
+        reference operator*() const { return camino[profundidad - 1].nodo->claves[camino[profundidad - 1].indice]; }
+        pointer operator->() const { return &**this; }
+        template <typename C = Carga>
+        const C& carga() const { return camino[profundidad - 1].nodo->cargas[camino[profundidad - 1].indice]; }
+
+        const_iterator& operator++();
+        const_iterator& operator--();
+        const_iterator operator++(int) { const_iterator previo(*this); ++*this; return previo; }
+        const_iterator operator--(int) { const_iterator previo(*this); --*this; return previo; }
+
+        bool operator==(const const_iterator& c) const;
+        bool operator!=(const const_iterator& c) const { return !(*this == c); }
+
+    private:
+        friend class StarBTree;
+        friend class Instantanea;
+
+        // Cada hoja está a lo sumo a 32 niveles: los nodos internos tienen al menos
+        // dos hijos y la cantidad de elementos cabe en un int
+        static constexpr int alturaMaxima = 32;
+
+        struct Paso {
+            const Nodo* nodo;
+            int indice; ///< Clave actual en el tope; hijo por el que se bajó en los demás
+        };
+
+        const Nodo* raizArbol; ///< Raíz desde la que se recorre (del árbol o de una instantánea)
+        Paso camino[alturaMaxima];
+        int profundidad; ///< 0 representa end()
+
+        explicit const_iterator(const Nodo* r) : raizArbol(r), profundidad(0) {}
+        void Apilar(const Nodo* nodo, int indice) { camino[profundidad++] = Paso{nodo, indice}; }
+        void BajarIzquierda(const Nodo* nodo);
+        void BajarDerecha(const Nodo* nodo);
+        void Subir();
+    };
+
+    /**
+     * Iterador que además permite modificar la carga, que no participa del orden. Solo lo
+     * entrega un árbol no constante (Colocar, Modificable); con carga no hay instantáneas,
+     * así que ningún otro árbol comparte los nodos que modifica.
+     */
+    class iterator : public const_iterator {
+    public:
+        iterator() {}
+
+        template <typename C = Carga>
+        C& carga() const { return const_cast<C&>(const_iterator::template carga<C>()); } // Los nodos no son constantes
+
+        iterator& operator++() { const_iterator::operator++(); return *this; }
+        iterator& operator--() { const_iterator::operator--(); return *this; }
+        iterator operator++(int) { iterator previo(*this); ++*this; return previo; }
+        iterator operator--(int) { iterator previo(*this); --*this; return previo; }
+
+    private:
+        friend class StarBTree;
+
+        explicit iterator(const const_iterator& c) : const_iterator(c) {}
+    };
+
+    /**
+     * Vista inmutable del árbol. Mientras exista, el árbol copia cada nodo compartido antes
+     * de modificarlo (el camino desde la raíz y los hermanos que reorganiza), de modo que la
+     * vista no cambia. Puede leerse desde otro hilo mientras el árbol sigue insertando; los
+     * nodos que solo ella usa se liberan al destruir la última copia de la vista.
+     */
+    class Instantanea {
+    public:
+        Instantanea(const Instantanea& c);
+        Instantanea(Instantanea&& c) noexcept;
+        Instantanea& operator=(Instantanea c) noexcept;
+        ~Instantanea();
+
+        bool Buscar(const Type& valor) const;
+        int CantElem() const { return cantElem; }
+
+        const_iterator begin() const;
+        const_iterator end() const { return const_iterator(raiz); }
+        template <typename Funcion>
+        void RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const;
+
+    private:
+        friend class StarBTree;
+
+        StarBTree* arbol;
+        Nodo* raiz;
+        int cantElem;
+
+        Instantanea(StarBTree* a, Nodo* r, int n) : arbol(a), raiz(r), cantElem(n) {}
+    };
+
 private:
     int cantElem;
-    struct Nodo {
+    Traza traza;
+    ContadoresArbol contadores; // Eventos estructurales desde la construcción (si Traza::contadores)
+
+    struct Cabecera {
         int elemNodo;
+        bool hoja; // Distingue Hoja de Interno sin mirar los hijos
+
+        explicit Cabecera(bool esHoja) : elemNodo(0), hoja(esHoja) {}
+    };
+
+    // Claves y, con carga, el arreglo paralelo de cargas a continuación
+    template <typename C, typename = void>
+    struct Elementos : Cabecera {
+        Type claves[grado];
+        C cargas[grado]; // No participa del orden
+
+        using Cabecera::Cabecera;
+    };
+    template <typename Vacio>
+    struct Elementos<void, Vacio> : Cabecera {
         Type claves[grado];
+
+        using Cabecera::Cabecera;
+    };
+
+    struct Nodo : Elementos<Carga> {
+        explicit Nodo(bool esHoja) : Elementos<Carga>(esHoja) {}
+    };
+
+    // Clave con su carga, para los repartos que pasan por un arreglo temporal
+    template <typename C>
+    struct ClaveConCarga {
+        Type clave;
+        C carga;
+    };
+    static constexpr bool conCarga = !std::is_void<Carga>::value;
+    using Entrada = typename std::conditional<conCarga, ClaveConCarga<Carga>, Type>::type;
+
+    // Cantidad de elementos bajo cada hijo; sin conteos no ocupa lugar
+    template <bool activo, typename = void>
+    struct ConteosHijos {
+        int conteo[grado + 1];
+    };
+    template <typename Vacio>
+    struct ConteosHijos<false, Vacio> {};
+
+    // Alineado a su presupuesto si lo llena (ver GeometriaNodo)
+    struct alignas(AlineacionNodo<Type, grado, conteos, Carga>::valor) Interno : Nodo, ConteosHijos<conteos> {
         Nodo* hijo[grado + 1];
-        
-        Nodo() : elemNodo(0) {
+
+        Interno() : Nodo(false) {
             for(int i = 0; i <= grado; ++i) {
                 hijo[i] = nullptr;
             }
         }
-    } *raiz;
+    };
+
+    // Las hojas, la gran mayoría de los nodos, no reservan el arreglo de hijos
+    struct alignas(AlineacionNodo<Type, grado, conteos, Carga>::valorHoja) Hoja : Nodo {
+        Hoja() : Nodo(true) {}
+    };
+
+    Asignador<Interno> asignadorInterno; // Política de memoria de los nodos internos
+    Asignador<Hoja> asignadorHoja;       // Política de memoria de las hojas
+    Nodo* raiz;
+    Compare comparar; // Orden de las claves
+    std::atomic<int> instantaneas; // Instantáneas vivas; con alguna, la memoria se protege con candado
+    std::mutex candado; // Serializa el pool y compartidos entre el árbol y la liberación de instantáneas
+    // Referencias de más de los nodos compartidos con instantáneas; un nodo ausente tiene una
+    // sola. Vive fuera de los nodos para no restarles lugar cuando no hay instantáneas.
+    std::unordered_map<const Nodo*, int> compartidos;
+
+    using Busqueda = BusquedaNodo<Type, grado, Compare>; // Estrategia de búsqueda dentro del nodo
+
+    static constexpr int minClaves = Reorganizacion::MinClaves(grado); // Mínimo de claves fuera de la raíz
+    static constexpr int grupoLote = 16; // Búsquedas intercaladas por BuscarLote
+
+    static Interno* ComoInterno(Nodo* nodo) { return static_cast<Interno*>(nodo); }
+    static const Interno* ComoInterno(const Nodo* nodo) { return static_cast<const Interno*>(nodo); }
+    static void Precargar(const Nodo* nodo); // Pide a la caché las líneas de claves del nodo
 
     // Métodos auxiliares privados
+    Nodo* CrearNodo(bool hoja);
+    void Destruir(Nodo* nodo);
+    std::unique_lock<std::mutex> BloquearMemoria();
+    bool Compartido(const Nodo* nodo); // Si alguna instantánea también apunta al nodo
+    void Referenciar(const Nodo* nodo); // Suma una referencia
+    bool Desreferenciar(const Nodo* nodo); // Resta una referencia; true si era la última
+    void Soltar(Nodo* nodo); // Quita una referencia; libera el subárbol que nadie más usa
+    Nodo* Duplicar(Nodo* nodo);
+    Nodo* Propio(Interno* padre, int indice); // Hijo listo para modificar (copiado si es compartido)
+    void Propios(Interno* padre, int desde, int hasta);
     Nodo* CopiarArbol(Nodo* subraiz);
-    void Agregar(Type valor, Nodo* subraiz);
-    //void Eliminar(Type valor, Nodo* subraiz);
+    template <typename Crear>
+    bool InsertarEntrada(const Type& valor, Crear crear, const_iterator* posicion = nullptr);
+    template <typename Crear>
+    bool Agregar(const Type& valor, Crear& crear, Nodo* subraiz, const_iterator* posicion); // Arma la entrada solo si se inserta
+    int AgregarLote(Type* valores, int n, Nodo* subraiz); // Devuelve cuántos valores consumió
+    bool Eliminar(const Type& valor, Nodo* subraiz);
     void Vaciar(Nodo* nodo);
-    bool Buscar(Type valor, Nodo* subraiz) const;
+    template <typename K>
+    bool Buscar(const K& valor, const Nodo* subraiz) const;
+    void Estadisticas(const Nodo* nodo, int nivel, EstadisticasArbol& e) const;
+
+    // Mantenimiento de los conteos (no hacen nada sin conteos)
+    static int Tamano(const Nodo* nodo); // Elementos del subárbol según los conteos del nodo
+    static void Recontar(Interno* padre, int desde, int hasta); // Recalcula conteo[desde..hasta]
+    static void Sumar(Interno* padre, int indice, int delta); // conteo[indice] += delta
+    int RangoHasta(const Type& valor, bool incluir) const; // Menores (o menores o iguales) que valor
+
+    // Movimiento de claves junto con su carga (sin carga, solo la clave)
+    static void Mover(Nodo* destino, int i, Nodo* origen, int j);
+    static Entrada Tomar(Nodo* nodo, int i);
+    static void Poner(Nodo* nodo, int i, Entrada&& entrada);
+    static const Type& ClaveDe(const Entrada& entrada);
 
     // Complementos para Agregar y Eliminar
-    bool EsHoja(Nodo* nodo) const;
-    void OrdenarNodo(Nodo* subraiz, int indiceHijo);
-    void Redistribuir(Nodo* subraiz, int indiceHijo);
-    void DividirTriple(Nodo* subraiz, int indiceHijo);
+    bool EsHoja(const Nodo* nodo) const;
+    void OrdenarNodo(Interno* subraiz, int indiceHijo);
+    void Redistribuir(Interno* padre, int indiceHijo, int hermano);
+    void RedistribuirVecino(Interno* padre, int indiceHijo, int indice);
+    int Nivelar(Interno* padre, int indice); // Parejo entre hijo[indice] e hijo[indice + 1]; devuelve las claves movidas
+    void RotarIzquierda(Interno* padre, int indice);
+    void RotarDerecha(Interno* padre, int indice);
+    void DividirTriple(Interno* padre, int indiceHijo, int posFusion);
+    void DividirDoble(Interno* padre, int indiceHijo);
+    Nodo* PartirMitad(Nodo* nodo); // Mitad derecha a un nodo nuevo; la separadora queda tras las claves del original
+    void DividirRaiz();
+    void CorregirSubflujo(Interno* padre, int indiceHijo);
+    void FusionarTriple(Interno* padre, int inicio);
+    void FusionarDoble(Interno* padre);
+    void Notificar(TipoEvento tipo, int indiceHijo, int indiceHermano = -1);
+    void Contar(std::uint64_t ContadoresArbol::*contador, std::uint64_t n);
 
     // Métodos para impresión
     void ImprimirAsc(Nodo* nodo) const;
     void ImprimirDes(Nodo* nodo) const;
+
+    // Complemento para RecorrerRango
+    template <typename Funcion>
+    bool RecorrerRango(const Nodo* nodo, const Type& desde, const Type& hasta, Funcion& fn) const;
     
 };
 
+/**
+ * Árbol B* cuyo grado se deduce del tamaño de nodo deseado en bytes (64 = una línea
+ * de caché, 4096 = una página), del tamaño de Type y de si los nodos internos llevan
+ * conteos. Los nodos quedan alineados a ese tamaño.
+ */
+template <typename Type, std::size_t bytes, typename Traza = TrazaNula,
+          template <typename> class Asignador = PoolNodos, typename Compare = std::less<Type>,
+          bool conteos = false, typename Desborde = DesbordeVecino>
+using StarBTreePorBytes = StarBTree<Type, GeometriaNodo<Type, bytes, conteos>::grado, Traza, Asignador, Compare,
+                                    conteos, Desborde>;
+
 #include "../Templates/StarBTree.tpp"
 
 #endif // STARBTREE_HPP_INCLUDED
@@ -0,0 +1,115 @@
+#ifndef STARBTREECADENAS_HPP_INCLUDED
+#define STARBTREECADENAS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Reorganizacion.hpp"
+
+/**
+ * Árbol B* de cadenas con compresión de prefijos por nodo.
+ *
+ * Cada nodo guarda sus claves en un área de bytes propia: primero el prefijo común a
+ * todas sus claves (una sola vez) y a continuación los sufijos, uno tras otro, con el fin
+ * de cada sufijo en un arreglo de desplazamientos. No hay un std::string por clave ni una
+ * reserva de memoria por clave.
+ *
+ * Dentro de un nodo, la búsqueda compara la cadena buscada con el prefijo una vez y
+ * después solo compara sufijos. Las claves se ordenan byte a byte, igual que std::string.
+ *
+ * Las modificaciones recodifican los nodos que tocan (el prefijo se recalcula con la
+ * primera y la última clave). Qué hacer con un hijo desbordado o con subflujo lo decide
+ * Reorganizacion, como en StarBTree, y se ejecuta como un reparto de claves entre hermanos.
+ */
+template <int grado, typename Desborde = DesbordeVecino>
+class StarBTreeCadenas {
+    static_assert(grado >= 3, "La división triple requiere grado >= 3");
+public:
+    StarBTreeCadenas(); // Constructor por defecto
+    StarBTreeCadenas(const StarBTreeCadenas&) = delete;
+    StarBTreeCadenas& operator=(const StarBTreeCadenas&) = delete;
+    ~StarBTreeCadenas(); // Destructor
+
+    bool Insertar(std::string_view valor); // Agrega y devuelve si la cadena no existía
+    bool Eliminar(std::string_view valor); // Elimina y devuelve si la cadena existía
+    bool Buscar(std::string_view valor) const; // Busca una cadena en el árbol
+    int CantElem() const; // Devuelve la cantidad de elementos actuales
+
+    template <typename Funcion>
+    void RecorrerRango(std::string_view desde, std::string_view hasta, Funcion fn) const; // fn(const std::string&) en [desde, hasta]
+
+    void Vaciar(); // Vacía el árbol
+    std::size_t BytesClaves() const; // Memoria reservada para las áreas de claves
+
+private:
+    struct Nodo {
+        int elemNodo;
+        bool hoja;
+        std::uint32_t tamPrefijo;
+        std::uint32_t fin[grado]; // Fin de cada sufijo, contado desde el final del prefijo
+        char* area;               // Prefijo y sufijos contiguos
+        std::uint32_t capacidad;
+        Nodo* hijo[grado + 1];
+
+        explicit Nodo(bool esHoja) : elemNodo(0), hoja(esHoja), tamPrefijo(0), area(nullptr), capacidad(0) {
+            for (int i = 0; i <= grado; ++i) {
+                hijo[i] = nullptr;
+            }
+        }
+    };
+
+    /// Clave vista como prefijo del nodo más sufijo propio (sin copiarla)
+    struct Trozo {
+        std::string_view prefijo;
+        std::string_view sufijo;
+    };
+
+    /// Nodo recodificado en memoria temporal antes de reemplazar el área del nodo
+    struct Codificado {
+        std::vector<char> bytes;
+        std::uint32_t tamPrefijo;
+        std::uint32_t fin[grado + 1];
+        int n;
+    };
+
+    Nodo* raiz;
+    int cantElem;
+
+    // Reutilizados en cada modificación
+    std::vector<Codificado> temporal;
+    std::vector<Trozo> trozos;
+    std::vector<Nodo*> hijos;
+
+    // Lectura de claves
+    static Trozo Clave(const Nodo* nodo, int i);
+    static int Comparar(std::string_view valor, const Trozo& clave);
+    static int Posicion(const Nodo* nodo, std::string_view valor, bool& encontrado);
+
+    // Codificación
+    static void Codificar(const Trozo* claves, int n, Codificado& destino);
+    static void Asignar(Nodo* nodo, const Codificado& origen);
+
+    // Métodos auxiliares privados
+    bool Agregar(std::string_view valor, Nodo* subraiz);
+    bool Eliminar(std::string_view valor, Nodo* subraiz);
+    void Vaciar(Nodo* nodo);
+    std::size_t BytesClaves(const Nodo* nodo) const;
+
+    // Complementos para Insertar y Eliminar
+    void OrdenarHijo(Nodo* padre, int indiceHijo);
+    void CorregirSubflujo(Nodo* padre, int indiceHijo);
+    void Repartir(Nodo* padre, int desde, int cuantos, int nuevos);
+    void DividirRaiz();
+
+    // Complemento para RecorrerRango
+    template <typename Funcion>
+    bool RecorrerRango(const Nodo* nodo, std::string_view desde, std::string_view hasta,
+                       Funcion& fn, std::string& clave) const;
+};
+
+#include "../Templates/StarBTreeCadenas.tpp"
+
+#endif // STARBTREECADENAS_HPP_INCLUDED
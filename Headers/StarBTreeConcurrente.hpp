@@ -0,0 +1,106 @@
+#ifndef STARBTREECONCURRENTE_HPP_INCLUDED
+#define STARBTREECONCURRENTE_HPP_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "BusquedaNodo.hpp"
+#include "PoliticaDesborde.hpp"
+#include "Reorganizacion.hpp"
+
+/**
+ * Árbol B* para varios hilos con acoplamiento optimista de candados (OLC).
+ *
+ * Cada nodo tiene un contador de versión. Los lectores bajan sin tomar candados:
+ * leen la versión, leen el nodo y verifican que la versión no cambió; si cambió,
+ * reinician desde la raíz. Los escritores bloquean solo los nodos que modifican:
+ * la hoja donde insertan o, para reorganizar un hijo lleno, el padre, ese hijo y
+ * los hermanos que consulta la política Desborde (ver Reorganizacion::Desbordar); con
+ * DesbordeVecino, la de por defecto, a lo sumo los dos adyacentes.
+ *
+ * Los hijos llenos se reorganizan al bajar (de forma preventiva), por lo que un
+ * nodo nunca supera grado - 1 claves y una reorganización nunca se propaga hacia arriba.
+ * Las divisiones reutilizan los nodos existentes y solo crean nodos nuevos: ningún
+ * nodo se libera mientras el árbol está en uso, así que los lectores optimistas nunca
+ * siguen un puntero a memoria devuelta.
+ *
+ * Type debe poder copiarse trivialmente: un lector puede ver una clave a medio escribir,
+ * que descarta al fallar la validación.
+ */
+template <typename Type, int grado, typename Compare = std::less<Type>, typename Desborde = DesbordeVecino>
+class StarBTreeConcurrente {
+    static_assert(grado >= 4, "La división de la raíz llena requiere grado >= 4");
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "Las lecturas optimistas requieren claves trivialmente copiables");
+public:
+    explicit StarBTreeConcurrente(const Compare& comparar = Compare()); // Constructor por defecto
+    StarBTreeConcurrente(const StarBTreeConcurrente&) = delete;
+    StarBTreeConcurrente& operator=(const StarBTreeConcurrente&) = delete;
+    ~StarBTreeConcurrente(); // Destructor (sin otros hilos activos)
+
+    bool Insertar(const Type& valor); // Agrega y devuelve si el elemento no existía; seguro entre hilos
+    bool Buscar(const Type& valor) const; // Busca sin tomar candados; seguro entre hilos
+    int CantElem() const; // Cantidad de elementos (aproximada mientras hay escritores)
+
+    void Vaciar(); // Vacía el árbol (sin otros hilos activos)
+
+private:
+    struct Nodo {
+        std::atomic<std::uint64_t> version; // Bit 1: bloqueado; se suma 2 al bloquear y al desbloquear
+        std::atomic<int> elemNodo;
+        bool hoja;
+        Type claves[grado];
+        std::atomic<Nodo*> hijo[grado + 1];
+
+        explicit Nodo(bool esHoja) : version(0), elemNodo(0), hoja(esHoja) {
+            for(int i = 0; i <= grado; ++i) {
+                hijo[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    /// Resultado de un intento optimista
+    enum class Intento { Exito, Fallo, Reintentar };
+
+    static constexpr std::uint64_t bloqueado = 2;
+    static constexpr int lleno = grado - 1; // Máximo de claves estable por nodo
+
+    std::atomic<Nodo*> raiz;
+    std::atomic<int> cantElem;
+    Compare comparar; // Orden de las claves
+
+    using Busqueda = BusquedaNodo<Type, grado, Compare>; // Estrategia de búsqueda dentro del nodo
+
+    // Versiones y candados
+    static std::uint64_t LeerVersion(const Nodo* nodo);
+    static bool Validar(const Nodo* nodo, std::uint64_t version);
+    static bool Bloquear(Nodo* nodo, std::uint64_t version);
+    static void BloquearEsperando(Nodo* nodo);
+    static void Desbloquear(Nodo* nodo);
+
+    // Accesos atómicos a los campos que leen los lectores optimistas
+    static int Cantidad(const Nodo* nodo) { return nodo->elemNodo.load(std::memory_order_relaxed); }
+    static void FijarCantidad(Nodo* nodo, int n) { nodo->elemNodo.store(n, std::memory_order_relaxed); }
+    static Nodo* Hijo(const Nodo* nodo, int i) { return nodo->hijo[i].load(std::memory_order_acquire); }
+    static void FijarHijo(Nodo* nodo, int i, Nodo* h) { nodo->hijo[i].store(h, std::memory_order_release); }
+
+    // Métodos auxiliares privados
+    Intento IntentarBuscar(const Type& valor) const;
+    Intento IntentarInsertar(const Type& valor);
+    void Vaciar(Nodo* nodo);
+
+    // Complementos para Insertar (con los nodos involucrados ya bloqueados)
+    void OrdenarHijo(Nodo* padre, int indiceHijo);
+    void Rotar(Nodo* padre, int indice, bool haciaDerecha);
+    void Repartir(Nodo* padre, int indice);
+    void DividirTriple(Nodo* padre, int indice);
+    void DividirDoble(Nodo* padre, int indiceHijo);
+    Nodo* PartirMitad(Nodo* nodo);
+    void DividirRaiz(Nodo* vieja);
+};
+
+#include "../Templates/StarBTreeConcurrente.tpp"
+
+#endif // STARBTREECONCURRENTE_HPP_INCLUDED
@@ -0,0 +1,54 @@
+#ifndef STARBTREEDURABLE_HPP_INCLUDED
+#define STARBTREEDURABLE_HPP_INCLUDED
+
+#include <chrono>
+#include <functional>
+#include <string>
+
+#include "StarBTree.hpp"
+#include "Bitacora.hpp"
+
+/**
+ * Árbol B* en memoria con persistencia: una imagen (StarBTree::Guardar) más una bitácora
+ * de escritura anticipada con las operaciones posteriores a esa imagen.
+ *
+ * Cada inserción o eliminación que cambia el árbol se registra en ruta.wal; la bitácora
+ * la lleva al disco junto con las demás de su grupo, con una escritura secuencial y un
+ * fsync por grupo. Al abrir, se carga ruta.img (si existe) y se reproduce la bitácora.
+ * PuntoControl() guarda una imagen nueva y vacía la bitácora.
+ *
+ * Una operación es durable cuando su grupo se confirma: al completarse el grupo, al
+ * vencer el intervalo en una operación posterior, o al llamar a Confirmar().
+ */
+template <typename Type, int grado, typename Compare = std::less<Type>>
+class StarBTreeDurable {
+public:
+    using Arbol = StarBTree<Type, grado, TrazaNula, PoolNodos, Compare>;
+
+    explicit StarBTreeDurable(const std::string& ruta, int operacionesPorGrupo = 64,
+                              std::chrono::milliseconds intervalo = std::chrono::milliseconds(10),
+                              const Compare& comparar = Compare()); // Recupera desde ruta.img y ruta.wal
+    StarBTreeDurable(const StarBTreeDurable&) = delete;
+    StarBTreeDurable& operator=(const StarBTreeDurable&) = delete;
+
+    bool Insertar(const Type& valor); // Agrega, registra y devuelve si el elemento no existía
+    bool Eliminar(const Type& valor); // Elimina, registra y devuelve si existía
+    bool Buscar(const Type& valor) const; // Busca un elemento en el árbol
+    int CantElem() const; // Devuelve la cantidad de elementos actuales
+    const Arbol& Contenido() const; // Árbol en memoria, para recorridos y consultas por rango
+
+    void Confirmar(); // Lleva al disco las operaciones pendientes
+    void PuntoControl(); // Guarda una imagen nueva y vacía la bitácora
+
+private:
+    std::string ruta;
+    Arbol arbol;
+    Bitacora<Type> bitacora;
+
+    void Recuperar();
+    static void Sincronizar(const std::string& destino); // fsync de un archivo o directorio
+};
+
+#include "../Templates/StarBTreeDurable.tpp"
+
+#endif // STARBTREEDURABLE_HPP_INCLUDED
@@ -0,0 +1,132 @@
+#ifndef STARBTREEENTEROS_HPP_INCLUDED
+#define STARBTREEENTEROS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "BusquedaNodo.hpp"
+#include "HojaComprimida.hpp"
+#include "Reorganizacion.hpp"
+
+/**
+ * Árbol B* de claves enteras con hojas comprimidas.
+ *
+ * Los nodos internos son como los de StarBTree. Cada hoja guarda su menor clave como base
+ * y las demás como desplazamientos desde ella, todos con el mismo ancho (1, 2, 4 u 8
+ * bytes), el menor que alcanza para la mayor clave de la hoja (ver HojaComprimida). Con
+ * identificadores densos o marcas de tiempo cercanas, una hoja de 64 claves de 8 bytes
+ * ocupa 64 o 128 bytes de desplazamientos en lugar de 512.
+ *
+ * Los desplazamientos de hasta 2 bytes viven dentro de la hoja, así que Buscar no sigue
+ * otro puntero para llegar a ellos. Si la hoja necesita 4 u 8 bytes por desplazamiento
+ * (claves dispersas), van a un bloque aparte y el lugar en línea queda sin usar: se
+ * prefiere no pagar un salto de puntero en el caso denso, que es el que comprime.
+ *
+ * Como una hoja ocupa pocas líneas de caché, su capacidad (gradoHoja) puede ser mayor que
+ * la de los nodos internos, y el árbol queda más bajo. Buscar cuenta desplazamientos con
+ * SSE2 directamente sobre la hoja; los recorridos la decodifican completa, y las
+ * modificaciones la recodifican. Qué hacer con un hijo desbordado o con subflujo lo decide
+ * Reorganizacion, como en StarBTree, y se ejecuta como un reparto de claves entre hermanos.
+ */
+template <typename Type, int grado, int gradoHoja = 4 * grado, typename Desborde = DesbordeVecino>
+class StarBTreeEnteros {
+    static_assert(grado >= 3 && gradoHoja >= 3, "La división triple requiere grado >= 3");
+public:
+    StarBTreeEnteros(); // Constructor por defecto
+    StarBTreeEnteros(const StarBTreeEnteros&) = delete;
+    StarBTreeEnteros& operator=(const StarBTreeEnteros&) = delete;
+    ~StarBTreeEnteros(); // Destructor
+
+    bool Insertar(Type valor); // Agrega y devuelve si el elemento no existía
+    bool Eliminar(Type valor); // Elimina y devuelve si el elemento existía
+    bool Buscar(Type valor) const; // Busca un elemento en el árbol
+    int CantElem() const; // Devuelve la cantidad de elementos actuales
+    int Altura() const; // Niveles del árbol (0 si está vacío)
+
+    template <typename Funcion>
+    void RecorrerRango(Type desde, Type hasta, Funcion fn) const; // Visita [desde, hasta] en orden
+
+    void Vaciar(); // Vacía el árbol
+    std::size_t BytesNodos() const; // Memoria de nodos y desplazamientos
+
+private:
+    /// Bytes de desplazamientos dentro de la hoja: gradoHoja claves de hasta 2 bytes
+    static constexpr std::size_t bytesEnLinea = 2 * static_cast<std::size_t>(gradoHoja);
+
+    struct Nodo {
+        int elemNodo;
+        bool hoja;
+
+        explicit Nodo(bool esHoja) : elemNodo(0), hoja(esHoja) {}
+    };
+
+    struct Interno : Nodo {
+        Type claves[grado];
+        Nodo* hijo[grado + 1];
+
+        Interno() : Nodo(false) {
+            for (int i = 0; i <= grado; ++i) {
+                hijo[i] = nullptr;
+            }
+        }
+    };
+
+    struct Hoja : Nodo {
+        int ancho;                 // Bytes por desplazamiento
+        std::uint32_t capacidad;   // Bytes reservados fuera de la hoja (0: en línea)
+        Type base;                 // Menor clave de la hoja
+        union {
+            unsigned char enLinea[bytesEnLinea]; // elemNodo desplazamientos contiguos
+            unsigned char* externos;             // Idem, cuando no caben en línea
+        };
+
+        Hoja() : Nodo(true), ancho(1), capacidad(0), base() {}
+
+        const unsigned char* Datos() const { return capacidad == 0 ? enLinea : externos; }
+        unsigned char* Datos() { return capacidad == 0 ? enLinea : externos; }
+    };
+
+    using Busqueda = BusquedaNodo<Type, grado>; // Estrategia de búsqueda en los nodos internos
+    using Compresion = HojaComprimida<Type>;
+
+    static constexpr int maxClaves = grado > gradoHoja ? grado : gradoHoja;
+
+    Nodo* raiz;
+    int cantElem;
+
+    // Reutilizados en cada reparto
+    std::vector<Type> tramoClaves;
+    std::vector<Nodo*> tramoHijos;
+
+    static Interno* ComoInterno(Nodo* nodo) { return static_cast<Interno*>(nodo); }
+    static const Interno* ComoInterno(const Nodo* nodo) { return static_cast<const Interno*>(nodo); }
+    static Hoja* ComoHoja(Nodo* nodo) { return static_cast<Hoja*>(nodo); }
+    static const Hoja* ComoHoja(const Nodo* nodo) { return static_cast<const Hoja*>(nodo); }
+    static int Capacidad(const Nodo* nodo) { return nodo->hoja ? gradoHoja : grado; }
+
+    // Claves de un nodo como arreglo plano (las hojas se decodifican y recodifican)
+    static int Extraer(const Nodo* nodo, Type* destino);
+    static void Escribir(Nodo* nodo, const Type* claves, int n);
+
+    // Métodos auxiliares privados
+    bool Agregar(Type valor, Nodo* subraiz);
+    bool Eliminar(Type valor, Nodo* subraiz);
+    static void Destruir(Nodo* nodo);
+    void Vaciar(Nodo* nodo);
+    std::size_t BytesNodos(const Nodo* nodo) const;
+
+    // Complementos para Insertar y Eliminar
+    void OrdenarHijo(Interno* padre, int indiceHijo);
+    void CorregirSubflujo(Interno* padre, int indiceHijo);
+    void Repartir(Interno* padre, int desde, int cuantos, int nuevos);
+    void DividirRaiz();
+
+    // Complemento para RecorrerRango
+    template <typename Funcion>
+    bool RecorrerRango(const Nodo* nodo, Type desde, Type hasta, Funcion& fn) const;
+};
+
+#include "../Templates/StarBTreeEnteros.tpp"
+
+#endif // STARBTREEENTEROS_HPP_INCLUDED
@@ -0,0 +1,97 @@
+#ifndef STARBTREEIMAGEN_HPP_INCLUDED
+#define STARBTREEIMAGEN_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Vista de solo lectura de un Árbol B* guardado con StarBTree::Guardar.
+ *
+ * La imagen es una cabecera de 64 bytes seguida de los nodos en orden por niveles, todos
+ * del mismo tamaño: { uint32 elemNodo; uint32 primerHijo; Type claves[grado - 1]; }.
+ * Los hijos de un nodo son consecutivos, así que basta guardar el índice del primero;
+ * primerHijo == 0 marca una hoja (el nodo 0 es la raíz y nunca es hijo). La cabecera
+ * lleva una suma de verificación FNV-1a de todos los nodos.
+ *
+ * El archivo se proyecta en memoria (mmap) y Buscar y RecorrerRango leen los nodos
+ * directamente de la proyección, sin reconstruir el árbol; en sistemas sin mmap se lee
+ * completo a un búfer. El formato usa el orden de bytes de la máquina que lo escribió.
+ *
+ * Cada nodo se comprueba además al visitarlo (claves dentro de la capacidad, hijos dentro
+ * de la imagen y después del padre), así que aun sin verificar la suma un archivo dañado
+ * produce una excepción y no una lectura fuera de la proyección ni un ciclo.
+ */
+template <typename Type, typename Compare = std::less<Type>>
+class StarBTreeImagen {
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "La imagen guarda las claves byte a byte");
+    static_assert(alignof(Type) <= 64, "Las claves no pueden requerir más alineación que la cabecera");
+public:
+    /// Cabecera del archivo (64 bytes, al inicio)
+    struct Cabecera {
+        std::uint32_t firma;
+        std::uint32_t version;
+        std::uint32_t tamClave;
+        std::uint32_t clavesPorNodo; ///< grado - 1 del árbol que la escribió
+        std::uint64_t cantElem;
+        std::uint64_t cantNodos;
+        std::uint64_t tamRegistro; ///< Bytes por nodo
+        std::uint64_t sumaVerificacion; ///< FNV-1a de los nodos
+        std::uint8_t reservado[16];
+    };
+    static_assert(sizeof(Cabecera) == 64, "La cabecera ocupa exactamente 64 bytes");
+
+    static constexpr std::uint32_t firmaImagen = 0x49544253; // "SBTI"
+    static constexpr std::uint32_t versionImagen = 1;
+    static constexpr std::uint64_t semillaSuma = 14695981039346656037ull; // Base de FNV-1a
+
+    /// Desplazamiento de las claves dentro de un nodo
+    static constexpr std::size_t desplClaves = (8 + alignof(Type) - 1) / alignof(Type) * alignof(Type);
+
+    static constexpr std::size_t TamRegistro(std::size_t clavesPorNodo); // Bytes por nodo con esa capacidad
+    static std::uint64_t Sumar(std::uint64_t suma, const unsigned char* datos, std::size_t tam); // Acumula FNV-1a
+
+    explicit StarBTreeImagen(const std::string& ruta, bool verificar = true,
+                             const Compare& comparar = Compare()); // Proyecta y valida la imagen
+    StarBTreeImagen(const StarBTreeImagen&) = delete;
+    StarBTreeImagen& operator=(const StarBTreeImagen&) = delete;
+    ~StarBTreeImagen(); // Libera la proyección
+
+    bool Buscar(const Type& valor) const; // Busca un elemento en la imagen
+    std::size_t CantElem() const; // Devuelve la cantidad de elementos
+
+    template <typename Funcion>
+    void RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const; // Visita [desde, hasta] en orden
+    template <typename Funcion>
+    void Recorrer(Funcion fn) const; // Visita todos los elementos en orden
+
+private:
+    const unsigned char* base; // Inicio del archivo (proyectado o copiado)
+    std::size_t tam;
+    bool proyectado;
+    std::vector<unsigned char> copia; // Contenido cuando no hay mmap
+    Cabecera cabecera;
+    Compare comparar; // Orden de las claves
+
+    // Acceso a los campos de un nodo dentro de la imagen
+    const unsigned char* Registro(std::uint64_t nodo) const { return base + sizeof(Cabecera) + nodo * cabecera.tamRegistro; }
+    std::uint32_t ElemNodo(const unsigned char* r) const { return reinterpret_cast<const std::uint32_t*>(r)[0]; }
+    std::uint32_t PrimerHijo(const unsigned char* r) const { return reinterpret_cast<const std::uint32_t*>(r)[1]; }
+    const Type* Claves(const unsigned char* r) const { return reinterpret_cast<const Type*>(r + desplClaves); }
+    const unsigned char* Visitar(std::uint64_t nodo) const; // Registro del nodo, comprobado
+
+    void Abrir(const std::string& ruta);
+    void Cerrar();
+    void Validar(bool verificar);
+
+    template <typename Funcion>
+    bool RecorrerRango(std::uint64_t nodo, const Type* desde, const Type* hasta, Funcion& fn) const;
+};
+
+#include "../Templates/StarBTreeImagen.tpp"
+
+#endif // STARBTREEIMAGEN_HPP_INCLUDED
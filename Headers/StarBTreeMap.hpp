@@ -0,0 +1,109 @@
+#ifndef STARBTREEMAP_HPP_INCLUDED
+#define STARBTREEMAP_HPP_INCLUDED
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "StarBTree.hpp"
+
+/**
+ * Árbol B* asociativo (clave -> valor). Es un StarBTree de claves con el valor como
+ * carga: cada nodo guarda las claves en un arreglo denso y los valores en un arreglo
+ * paralelo, de modo que la búsqueda solo recorre las líneas de caché de las claves. La
+ * reorganización (reparto con un vecino, división triple, préstamos y fusiones) es la de
+ * StarBTree; cada movimiento de una clave arrastra su valor.
+ */
+template <typename Key, typename Value, int grado, typename Traza = TrazaNula,
+          template <typename> class Asignador = PoolNodos>
+class StarBTreeMap {
+private:
+    using Arbol = StarBTree<Key, grado, Traza, Asignador, std::less<Key>, false, DesbordeVecino, Value>;
+    template <bool Constante> class Iterador;
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using iterator = Iterador<false>;
+    using const_iterator = Iterador<true>;
+
+    explicit StarBTreeMap(); // Constructor por defecto
+
+    // Consulta
+    iterator find(const Key& clave);
+    const_iterator find(const Key& clave) const;
+    bool Buscar(const Key& clave) const; // Indica si la clave está en el mapa
+
+    // Inserción
+    Value& operator[](const Key& clave); // Inserta un valor por defecto si la clave no existe
+    template <typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& clave, V&& valor);
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& clave, Args&&... args); // No modifica si ya existe
+
+    bool Eliminar(const Key& clave); // Elimina la clave; devuelve si existía
+    int CantElem() const; // Devuelve la cantidad de pares actuales
+    void Vaciar(); // Vacía el mapa
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    Traza& ObtenerTraza(); // Acceso a la política de traza
+
+private:
+    /**
+     * @brief Iterador bidireccional en orden de clave. Desreferenciar devuelve un par
+     * de referencias (first: clave, second: valor), ya que clave y valor viven en
+     * arreglos separados.
+     */
+    template <bool Constante>
+    class Iterador {
+    public:
+        using ValorRef = typename std::conditional<Constante, const Value&, Value&>::type;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const Key&, ValorRef>;
+
+        struct pointer {
+            reference par;
+            const reference* operator->() const { return &par; }
+        };
+
+        Iterador() {}
+        template <bool C = Constante, typename = typename std::enable_if<C>::type>
+        Iterador(const Iterador<false>& c) : it(c.it) {}
+
+        reference operator*() const { return reference(*it, it.carga()); }
+        pointer operator->() const { return pointer{**this}; }
+
+        Iterador& operator++() { ++it; return *this; }
+        Iterador& operator--() { --it; return *this; }
+        Iterador operator++(int) { Iterador previo(*this); ++*this; return previo; }
+        Iterador operator--(int) { Iterador previo(*this); --*this; return previo; }
+
+        bool operator==(const Iterador& c) const { return it == c.it; }
+        bool operator!=(const Iterador& c) const { return !(*this == c); }
+
+    private:
+        friend class StarBTreeMap;
+        template <bool> friend class Iterador;
+
+        using Posicion = typename std::conditional<Constante, typename Arbol::const_iterator,
+                                                   typename Arbol::iterator>::type;
+
+        Posicion it; ///< Posición en el árbol de claves; solo la no constante modifica el valor
+
+        explicit Iterador(const Posicion& i) : it(i) {}
+    };
+
+    Arbol arbol; // Claves con los valores como carga
+};
+
+#include "../Templates/StarBTreeMap.tpp"
+
+#endif // STARBTREEMAP_HPP_INCLUDED
@@ -0,0 +1,115 @@
+#ifndef STARBTREEPAGINADO_HPP_INCLUDED
+#define STARBTREEPAGINADO_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include "BusquedaNodo.hpp"
+#include "BufferPaginas.hpp"
+#include "PoliticaDesborde.hpp"
+#include "Reorganizacion.hpp"
+
+/**
+ * Árbol B* guardado en un archivo, para índices más grandes que la memoria.
+ *
+ * Cada nodo es una página de tamaño fijo y los hijos se referencian por número de página
+ * en lugar de puntero. Las páginas se leen a través de un BufferPaginas con reemplazo
+ * CLOCK y una cantidad fija de marcos. La página 0 guarda la cabecera (raíz, cantidad de
+ * elementos y parámetros con los que se creó el archivo).
+ *
+ * Un hijo desbordado se resuelve como en StarBTree, según la política Desborde (ver
+ * Reorganizacion::Desbordar). Con DesbordeVecino, la de por defecto, se reparte por mitades
+ * con un hermano adyacente que tenga espacio o, si ambos están llenos, se hace la división
+ * triple: cada desborde modifica a lo sumo el padre, el hijo y un hermano (más la página
+ * nueva de la división), y los nodos quedan llenos en al menos dos tercios, con lo que se
+ * escriben menos páginas que con divisiones binarias.
+ *
+ * Type debe poder copiarse trivialmente: las claves se escriben byte a byte en el archivo.
+ * El archivo no es portable entre arquitecturas con distinto orden de bytes, ni consistente
+ * tras una caída entre dos llamadas a Sincronizar (ver BufferPaginas); StarBTreeDurable
+ * es la variante que se recupera de una caída.
+ */
+template <typename Type, int grado, typename Compare = std::less<Type>, typename Desborde = DesbordeVecino>
+class StarBTreePaginado {
+    static_assert(grado >= 3, "La división triple requiere grado >= 3");
+    static_assert(std::is_trivially_copyable<Type>::value,
+                  "Las claves se guardan byte a byte en el archivo");
+public:
+    using IdPagina = std::uint32_t;
+
+    explicit StarBTreePaginado(const std::string& ruta, std::size_t marcos = 1024,
+                               const Compare& comparar = Compare()); // Abre o crea el archivo
+    StarBTreePaginado(const StarBTreePaginado&) = delete;
+    StarBTreePaginado& operator=(const StarBTreePaginado&) = delete;
+    ~StarBTreePaginado(); // Sincroniza antes de cerrar
+
+    bool Insertar(const Type& valor); // Agrega y devuelve si el elemento no existía
+    bool Buscar(const Type& valor) const; // Busca un elemento en el árbol
+    int CantElem() const; // Devuelve la cantidad de elementos actuales
+
+    template <typename Funcion>
+    void RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const; // Visita [desde, hasta] en orden
+
+    void Sincronizar(); // Escribe la cabecera y las páginas sucias
+
+    std::size_t PaginasLeidas() const; // Lecturas del archivo desde que se abrió
+    std::size_t PaginasEscritas() const; // Escrituras al archivo desde que se abrió
+
+private:
+    struct Pagina {
+        int elemNodo;
+        bool hoja;
+        Type claves[grado];
+        IdPagina hijo[grado + 1]; // 0 = sin hijo (la página 0 es la cabecera)
+    };
+
+    struct Cabecera {
+        std::uint32_t firma;
+        std::uint32_t version;
+        std::uint32_t gradoArbol;
+        std::uint32_t tamClave;
+        IdPagina raiz;
+        std::int32_t cantElem;
+    };
+    static_assert(sizeof(Cabecera) <= sizeof(Pagina), "La cabecera debe caber en una página");
+
+public:
+    static constexpr std::size_t tamPagina = sizeof(Pagina); // Bytes por nodo en el archivo
+
+private:
+    using Buffer = BufferPaginas<Pagina>;
+    using Fijada = typename Buffer::Fijada;
+    using Busqueda = BusquedaNodo<Type, grado, Compare>; // Estrategia de búsqueda dentro del nodo
+
+    static constexpr std::uint32_t firmaArchivo = 0x50544253; // "SBTP"
+    static constexpr std::uint32_t versionArchivo = 1;
+
+    mutable Buffer buffer; // Leer también cambia qué páginas están en memoria
+    IdPagina raiz;
+    int cantElem;
+    Compare comparar; // Orden de las claves
+
+    // Métodos auxiliares privados
+    void LeerCabecera();
+    void EscribirCabecera();
+
+    // Complementos para Insertar (con las páginas involucradas ya fijadas)
+    void OrdenarHijo(Fijada& padre, Fijada& hijo, int indiceHijo);
+    void Rotar(Fijada& padre, int indice, bool haciaDerecha);
+    void Repartir(Fijada& padre, Fijada& izquierdo, Fijada& derecho, int indice);
+    void DividirTriple(Fijada& padre, Fijada& A, Fijada& C, int indice);
+    void DividirDoble(Fijada& padre, Fijada& hijo, int indiceHijo);
+    Fijada PartirMitad(Fijada& nodo);
+    void DividirRaiz();
+
+    // Complemento para RecorrerRango
+    template <typename Funcion>
+    bool RecorrerRango(IdPagina id, const Type& desde, const Type& hasta, Funcion& fn) const;
+};
+
+#include "../Templates/StarBTreePaginado.tpp"
+
+#endif // STARBTREEPAGINADO_HPP_INCLUDED
@@ -0,0 +1,97 @@
+#ifndef STARBTREETRAZA_HPP_INCLUDED
+#define STARBTREETRAZA_HPP_INCLUDED
+
+#include <iostream>
+
+/**
+ * @file StarBTreeTraza.hpp
+ * @brief Políticas de traza (observadores) para los eventos estructurales del Árbol B*.
+ * @details El árbol recibe la política como parámetro de plantilla. Una política declara:
+ *  - activa: si recibe cada evento en Notificar.
+ *  - contadores: si StarBTree acumula los ContadoresArbol que devuelve Estadisticas().
+ * Con TrazaNula (por defecto) ambas son falsas y las notificaciones se descartan en tiempo
+ * de compilación: las inserciones no pagan ni un incremento por evento.
+ */
+
+/**
+ * @brief Tipos de eventos estructurales que emite el árbol durante la inserción y la eliminación.
+ */
+enum class TipoEvento {
+    Descenso,                ///< Se baja un nivel hacia el hijo indicado
+    RedistribucionIzquierda, ///< Se pasa una clave hacia un hermano izquierdo
+    RedistribucionDerecha,   ///< Se pasa una clave hacia un hermano derecho
+    DivisionTriple,          ///< Un hijo lleno y un hermano se dividen en tres
+    DivisionDoble,           ///< Un hijo lleno se divide en dos (política de desborde clásica)
+    DivisionRaiz,            ///< La raíz se divide y el árbol crece un nivel
+    Fusion,                  ///< Hermanos con subflujo se fusionan (3 en 2, o 2 en 1 bajo la raíz)
+    ContraccionRaiz          ///< La raíz queda vacía y el árbol pierde un nivel
+};
+
+/**
+ * @brief Evento estructural entregado a la política de traza.
+ */
+struct EventoTraza {
+    TipoEvento tipo;
+    int indiceHijo;    ///< Hijo del padre que origina el evento (-1 si es la raíz)
+    int indiceHermano; ///< Hermano involucrado (-1 si no aplica)
+};
+
+/**
+ * @brief Política por defecto: no registra nada y no genera código.
+ */
+struct TrazaNula {
+    static constexpr bool activa = false;
+    static constexpr bool contadores = false;
+    void Notificar(const EventoTraza&) {}
+};
+
+/**
+ * @brief Política de medición: solo acumula los contadores de StarBTree::Estadisticas().
+ */
+struct TrazaContadores {
+    static constexpr bool activa = false;
+    static constexpr bool contadores = true;
+    void Notificar(const EventoTraza&) {}
+};
+
+/**
+ * @brief Política de depuración que escribe cada evento en std::cout.
+ */
+struct TrazaConsola {
+    static constexpr bool activa = true;
+    static constexpr bool contadores = true;
+
+    void Notificar(const EventoTraza& e) {
+        switch(e.tipo) {
+            case TipoEvento::Descenso:
+                std::cout << "Bajando un nivel hacia el hijo[" << e.indiceHijo << "]" << std::endl;
+                break;
+            case TipoEvento::RedistribucionIzquierda:
+                std::cout << "Redistribuyendo el hijo[" << e.indiceHijo << "] hacia la izquierda con el hijo["
+                          << e.indiceHermano << "]" << std::endl;
+                break;
+            case TipoEvento::RedistribucionDerecha:
+                std::cout << "Redistribuyendo el hijo[" << e.indiceHijo << "] hacia la derecha con el hijo["
+                          << e.indiceHermano << "]" << std::endl;
+                break;
+            case TipoEvento::DivisionTriple:
+                std::cout << "División triple de los hijos[" << e.indiceHijo << "] y ["
+                          << e.indiceHermano << "]" << std::endl;
+                break;
+            case TipoEvento::DivisionDoble:
+                std::cout << "División doble del hijo[" << e.indiceHijo << "]" << std::endl;
+                break;
+            case TipoEvento::DivisionRaiz:
+                std::cout << "Dividiendo el nodo raíz" << std::endl;
+                break;
+            case TipoEvento::Fusion:
+                std::cout << "Fusionando los hijos[" << e.indiceHijo << ".." << e.indiceHermano << "]" << std::endl;
+                break;
+            case TipoEvento::ContraccionRaiz:
+                std::cout << "La raíz quedó vacía, el árbol pierde un nivel" << std::endl;
+                break;
+        }
+    }
+};
+
+#endif // STARBTREETRAZA_HPP_INCLUDED
@@ -27,13 +27,14 @@ int main() {
             case 1:
                 cout << "Ingrese el elemento a agregar: ";
                 cin >> valor;
-                arbol.Agregar(valor);
+                if (!arbol.Insertar(valor))
+                    cout << "El valor " << valor << " ya existe en el árbol" << endl;
                 break;
             case 2:
-                cout << "Se lo debemos para el el siguiente semestre" << endl;
-                //cout << "Ingrese el elemento a eliminar: ";
-                //cin >> valor;
-                //arbol.Eliminar(valor);
+                cout << "Ingrese el elemento a eliminar: ";
+                cin >> valor;
+                if (!arbol.Eliminar(valor))
+                    cout << "El elemento " << valor << " no existe en el árbol." << endl;
                 break;
             case 3:
                 cout << "Ingrese el elemento a buscar: ";
@@ -0,0 +1,222 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include "../Headers/Bitacora.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+/**
+ * @file Bitacora.tpp
+ * @brief Implementación de la bitácora de escritura anticipada con confirmación en grupo.
+ * @tparam Type Tipo de los valores (trivialmente copiable).
+ */
+
+/**
+ * @brief Abre la bitácora (o la crea) y descarta un registro final incompleto.
+ * @param ruta Ruta del archivo de la bitácora.
+ * @param operacionesPorGrupo Operaciones que se juntan antes de confirmar (1 = fsync por operación).
+ * @param intervalo Tiempo máximo que una operación espera su confirmación si siguen llegando otras.
+ * @throws std::runtime_error Si el archivo no se puede abrir o no es una bitácora de este tipo.
+ */
+template <typename Type>
+Bitacora<Type>::Bitacora(const std::string& ruta, int operacionesPorGrupo, std::chrono::milliseconds intervalo)
+    : ruta(ruta), archivo(nullptr), finValido(tamCabecera), operacionesPorGrupo(operacionesPorGrupo),
+      intervalo(intervalo), ultimaConfirmacion(std::chrono::steady_clock::now()), pendientes(0), confirmaciones(0) {
+    Abrir();
+}
+
+/**
+ * @brief Confirma lo pendiente y cierra el archivo; los errores de escritura se descartan.
+ */
+template <typename Type>
+Bitacora<Type>::~Bitacora() {
+    try {
+        Confirmar();
+    } catch (...) {
+    }
+    std::fclose(archivo);
+}
+
+/**
+ * @brief Agrega una operación al grupo en curso y lo confirma si está completo o vencido.
+ *
+ * Si lanza, la operación no quedó registrada: el archivo vuelve a su último registro
+ * íntegro y las operaciones anteriores del grupo siguen pendientes.
+ *
+ * @param operacion Tipo de operación.
+ * @param valor Valor afectado.
+ * @throws std::runtime_error Si falla la escritura del grupo.
+ */
+template <typename Type>
+void Bitacora<Type>::Registrar(Operacion operacion, const Type& valor) {
+    unsigned char registro[tamRegistro];
+    registro[0] = static_cast<unsigned char>(operacion);
+    std::memcpy(registro + 1, &valor, sizeof(Type));
+    std::uint32_t suma = Sumar(registro, 1 + sizeof(Type));
+    std::memcpy(registro + 1 + sizeof(Type), &suma, sizeof(suma));
+
+    bufer.insert(bufer.end(), registro, registro + tamRegistro);
+    pendientes++;
+
+    if (static_cast<int>(pendientes) >= operacionesPorGrupo
+        || std::chrono::steady_clock::now() - ultimaConfirmacion >= intervalo) {
+        try {
+            Confirmar();
+        } catch (...) {
+            bufer.resize(bufer.size() - tamRegistro);
+            pendientes--;
+            throw;
+        }
+    }
+}
+
+/**
+ * @brief Escribe el grupo pendiente con una sola escritura secuencial y espera al disco.
+ *
+ * Si algo falla, el archivo se corta en el último registro íntegro y el grupo sigue
+ * pendiente: una escritura parcial no queda delante de los registros siguientes.
+ *
+ * @throws std::runtime_error Si falla la escritura o la sincronización.
+ */
+template <typename Type>
+void Bitacora<Type>::Confirmar() {
+    ultimaConfirmacion = std::chrono::steady_clock::now();
+    if (bufer.empty()) return;
+
+    bool escrito = std::fwrite(bufer.data(), 1, bufer.size(), archivo) == bufer.size() && std::fflush(archivo) == 0;
+#if defined(__unix__) || defined(__APPLE__)
+    bool sincronizado = escrito && fsync(fileno(archivo)) == 0;
+#else
+    bool sincronizado = escrito;
+#endif
+    if (!sincronizado) {
+        try {
+            Cortar(finValido);
+        } catch (...) {
+        }
+        throw std::runtime_error(escrito ? "No se pudo sincronizar la bitácora " + ruta
+                                         : "No se pudo escribir la bitácora " + ruta);
+    }
+
+    finValido += static_cast<long>(bufer.size());
+    bufer.clear();
+    pendientes = 0;
+    confirmaciones++;
+}
+
+/**
+ * @brief Vacía la bitácora, incluidas las operaciones pendientes.
+ *
+ * Solo debe llamarse cuando una imagen ya guardada contiene todas las operaciones.
+ *
+ * @throws std::runtime_error Si el archivo no se puede truncar.
+ */
+template <typename Type>
+void Bitacora<Type>::Truncar() {
+    bufer.clear();
+    pendientes = 0;
+    Cortar(tamCabecera);
+#if defined(__unix__) || defined(__APPLE__)
+    fsync(fileno(archivo));
+#endif
+}
+
+/**
+ * @brief Recorre los registros ya confirmados, en el orden en que se registraron.
+ * @param fn Función a llamar como fn(Operacion, const Type&).
+ * @return Cantidad de registros reproducidos.
+ * @throws std::runtime_error Si el archivo no se puede leer.
+ */
+template <typename Type>
+template <typename Funcion>
+std::size_t Bitacora<Type>::Reproducir(Funcion fn) const {
+    std::ifstream lector(ruta, std::ios::binary);
+    if (!lector) throw std::runtime_error("No se pudo leer la bitácora " + ruta);
+    lector.seekg(tamCabecera);
+
+    std::size_t cantidad = (finValido - tamCabecera) / tamRegistro;
+    unsigned char registro[tamRegistro];
+    Type valor;
+    for (std::size_t i = 0; i < cantidad; ++i) {
+        if (!lector.read(reinterpret_cast<char*>(registro), tamRegistro)) {
+            throw std::runtime_error("No se pudo leer la bitácora " + ruta);
+        }
+        std::memcpy(&valor, registro + 1, sizeof(Type));
+        fn(static_cast<Operacion>(registro[0]), valor);
+    }
+    return cantidad;
+}
+
+/**
+ * @brief Suma FNV-1a de 32 bits.
+ */
+template <typename Type>
+std::uint32_t Bitacora<Type>::Sumar(const unsigned char* datos, std::size_t tam) {
+    std::uint32_t suma = 2166136261u;
+    for (std::size_t i = 0; i < tam; ++i) {
+        suma ^= datos[i];
+        suma *= 16777619u;
+    }
+    return suma;
+}
+
+/**
+ * @brief Abre o crea el archivo, valida la cabecera y ubica el fin del último registro íntegro.
+ * @throws std::runtime_error Si el archivo no se puede abrir o no es una bitácora de este tipo.
+ */
+template <typename Type>
+void Bitacora<Type>::Abrir() {
+    std::uint32_t cabecera[4] = { firmaBitacora, versionBitacora, static_cast<std::uint32_t>(sizeof(Type)), 0 };
+
+    archivo = std::fopen(ruta.c_str(), "r+b");
+    std::uint32_t leida[4];
+    if (archivo == nullptr || std::fread(leida, 1, tamCabecera, archivo) != tamCabecera) {
+        // Archivo nuevo (o creado sin llegar a escribir la cabecera)
+        if (archivo != nullptr) std::fclose(archivo);
+        archivo = std::fopen(ruta.c_str(), "w+b");
+        if (archivo == nullptr) throw std::runtime_error("No se pudo crear la bitácora " + ruta);
+        if (std::fwrite(cabecera, 1, tamCabecera, archivo) != tamCabecera || std::fflush(archivo) != 0) {
+            std::fclose(archivo);
+            throw std::runtime_error("No se pudo escribir la bitácora " + ruta);
+        }
+        return;
+    }
+
+    if (leida[0] != cabecera[0] || leida[1] != cabecera[1] || leida[2] != cabecera[2]) {
+        std::fclose(archivo);
+        throw std::runtime_error("El archivo no es una bitácora de este tipo de valor: " + ruta);
+    }
+
+    // Avanzar mientras los registros estén completos y su suma coincida
+    unsigned char registro[tamRegistro];
+    while (std::fread(registro, 1, tamRegistro, archivo) == tamRegistro) {
+        std::uint32_t suma;
+        std::memcpy(&suma, registro + 1 + sizeof(Type), sizeof(suma));
+        if (suma != Sumar(registro, 1 + sizeof(Type))) break;
+        finValido += tamRegistro;
+    }
+
+    std::fseek(archivo, 0, SEEK_END);
+    if (std::ftell(archivo) != finValido) {
+        Cortar(finValido);
+    }
+}
+
+/**
+ * @brief Trunca el archivo y deja el cursor al final para seguir agregando.
+ * @param tam Nuevo tamaño en bytes.
+ * @throws std::runtime_error Si no se puede truncar.
+ */
+template <typename Type>
+void Bitacora<Type>::Cortar(long tam) {
+    std::fflush(archivo);
+    std::error_code error;
+    std::filesystem::resize_file(ruta, static_cast<std::uintmax_t>(tam), error);
+    if (error) throw std::runtime_error("No se pudo truncar la bitácora " + ruta);
+    std::fseek(archivo, tam, SEEK_SET);
+    std::clearerr(archivo);
+    finValido = tam;
+}
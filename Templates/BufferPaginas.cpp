@@ -0,0 +1,195 @@
+#include <stdexcept>
+#include "../Headers/BufferPaginas.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+/**
+ * @file BufferPaginas.tpp
+ * @brief Implementación del buffer de páginas con reemplazo CLOCK.
+ * @tparam Pagina Tipo trivialmente copiable que ocupa una página del archivo.
+ */
+
+/**
+ * @brief Abre el archivo de páginas o lo crea vacío si no existe.
+ * @param ruta Ruta del archivo.
+ * @param marcos Cantidad de páginas que pueden estar en memoria a la vez.
+ * @throws std::invalid_argument Si marcos es menor que 8.
+ * @throws std::runtime_error Si el archivo no se puede abrir o crear.
+ */
+template <typename Pagina>
+BufferPaginas<Pagina>::BufferPaginas(const std::string& ruta, std::size_t marcos)
+    : ruta(ruta), archivo(nullptr), marcos(marcos), manecilla(0), cantPaginas(0), lecturas(0), escrituras(0) {
+    if (marcos < 8) throw std::invalid_argument("El buffer necesita al menos 8 marcos");
+    // Los marcos se construyen en cero: libres y sin fijar
+
+    archivo = std::fopen(ruta.c_str(), "r+b");
+    if (archivo == nullptr) archivo = std::fopen(ruta.c_str(), "w+b");
+    if (archivo == nullptr) throw std::runtime_error("No se pudo abrir el archivo " + ruta);
+
+    std::fseek(archivo, 0, SEEK_END);
+    cantPaginas = static_cast<IdPagina>(static_cast<std::size_t>(std::ftell(archivo)) / sizeof(Pagina));
+}
+
+/**
+ * @brief Escribe las páginas sucias y cierra el archivo; los errores de escritura se descartan.
+ */
+template <typename Pagina>
+BufferPaginas<Pagina>::~BufferPaginas() {
+    try {
+        Sincronizar();
+    } catch (...) {
+    }
+    std::fclose(archivo);
+}
+
+/**
+ * @brief Fija una página existente, leyéndola del archivo si no está en memoria.
+ * @param id Identificador de la página.
+ * @return Acceso a la página.
+ * @throws std::out_of_range Si la página no existe.
+ * @throws std::runtime_error Si todos los marcos están fijados o falla la lectura.
+ */
+template <typename Pagina>
+typename BufferPaginas<Pagina>::Fijada BufferPaginas<Pagina>::Fijar(IdPagina id) {
+    if (id >= cantPaginas) throw std::out_of_range("Página fuera del archivo");
+
+    auto it = tabla.find(id);
+    std::size_t marco;
+    if (it != tabla.end()) {
+        marco = it->second;
+    } else {
+        marco = Victima();
+        Leer(id, marcos[marco].pagina);
+        marcos[marco].id = id;
+        marcos[marco].ocupado = true;
+        marcos[marco].sucia = false;
+        tabla[id] = marco;
+    }
+    marcos[marco].fijaciones++;
+    marcos[marco].referenciada = true;
+    return Fijada(this, marco, false);
+}
+
+/**
+ * @brief Agrega una página al final del archivo; llega en cero y sucia.
+ * @return Acceso a la página nueva (su identificador se obtiene con Id()).
+ * @throws std::runtime_error Si todos los marcos están fijados.
+ */
+template <typename Pagina>
+typename BufferPaginas<Pagina>::Fijada BufferPaginas<Pagina>::Nueva() {
+    std::size_t marco = Victima();
+    Marco& m = marcos[marco];
+    m.pagina = Pagina();
+    m.id = cantPaginas++;
+    m.ocupado = true;
+    m.sucia = true;
+    m.referenciada = true;
+    m.fijaciones = 1;
+    tabla[m.id] = marco;
+    return Fijada(this, marco, true);
+}
+
+/**
+ * @brief Escribe todas las páginas sucias y espera a que lleguen al disco.
+ *
+ * La página 0 se escribe al final, en una segunda sincronización, para que no llegue al
+ * disco antes que las páginas a las que apunta.
+ *
+ * @throws std::runtime_error Si falla la escritura o la sincronización.
+ */
+template <typename Pagina>
+void BufferPaginas<Pagina>::Sincronizar() {
+    Marco* primera = nullptr;
+    for (Marco& m : marcos) {
+        if (!m.ocupado || !m.sucia) continue;
+        if (m.id == 0) primera = &m;
+        else Escribir(m);
+    }
+    Volcar();
+    if (primera == nullptr) return;
+    Escribir(*primera);
+    Volcar();
+}
+
+/**
+ * @brief Elige un marco libre o desaloja una página con el algoritmo CLOCK.
+ *
+ * La manecilla salta los marcos fijados y da una segunda oportunidad a los que tienen el
+ * bit de referencia; dos vueltas completas bastan para encontrar víctima si la hay.
+ *
+ * @return Índice del marco ya vacío.
+ * @throws std::runtime_error Si todos los marcos están fijados.
+ */
+template <typename Pagina>
+std::size_t BufferPaginas<Pagina>::Victima() {
+    for (std::size_t vueltas = 0; vueltas < 2 * marcos.size(); ++vueltas) {
+        std::size_t actual = manecilla;
+        manecilla = (manecilla + 1) % marcos.size();
+
+        Marco& m = marcos[actual];
+        if (!m.ocupado) return actual;
+        if (m.fijaciones > 0) continue;
+        if (m.referenciada) {
+            m.referenciada = false;
+            continue;
+        }
+
+        if (m.sucia) Escribir(m);
+        tabla.erase(m.id);
+        m.ocupado = false;
+        return actual;
+    }
+    throw std::runtime_error("Todos los marcos del buffer están fijados");
+}
+
+/**
+ * @brief Quita una fijación del marco.
+ * @param marco Índice del marco.
+ * @param sucia true si quien lo tenía fijado modificó la página.
+ */
+template <typename Pagina>
+void BufferPaginas<Pagina>::Liberar(std::size_t marco, bool sucia) {
+    marcos[marco].fijaciones--;
+    if (sucia) marcos[marco].sucia = true;
+}
+
+/**
+ * @brief Lee una página del archivo.
+ * @throws std::runtime_error Si la lectura falla.
+ */
+template <typename Pagina>
+void BufferPaginas<Pagina>::Leer(IdPagina id, Pagina& pagina) {
+    if (std::fseek(archivo, static_cast<long>(id) * static_cast<long>(sizeof(Pagina)), SEEK_SET) != 0
+        || std::fread(&pagina, sizeof(Pagina), 1, archivo) != 1) {
+        throw std::runtime_error("No se pudo leer la página del archivo " + ruta);
+    }
+    lecturas++;
+}
+
+/**
+ * @brief Escribe la página del marco en su lugar del archivo y la deja limpia.
+ * @throws std::runtime_error Si la escritura falla.
+ */
+template <typename Pagina>
+void BufferPaginas<Pagina>::Escribir(Marco& marco) {
+    if (std::fseek(archivo, static_cast<long>(marco.id) * static_cast<long>(sizeof(Pagina)), SEEK_SET) != 0
+        || std::fwrite(&marco.pagina, sizeof(Pagina), 1, archivo) != 1) {
+        throw std::runtime_error("No se pudo escribir la página del archivo " + ruta);
+    }
+    marco.sucia = false;
+    escrituras++;
+}
+
+/**
+ * @brief Vacía el búfer de stdio y espera a que el sistema lleve el archivo al disco.
+ * @throws std::runtime_error Si falla alguno de los dos pasos.
+ */
+template <typename Pagina>
+void BufferPaginas<Pagina>::Volcar() {
+    if (std::fflush(archivo) != 0) throw std::runtime_error("No se pudo escribir el archivo " + ruta);
+#if defined(__unix__) || defined(__APPLE__)
+    if (fsync(fileno(archivo)) != 0) throw std::runtime_error("No se pudo sincronizar el archivo " + ruta);
+#endif
+}
@@ -0,0 +1,1086 @@
+#include <iostream>
+#include <queue>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include "../Headers/StarBPlusTree.hpp"
+
+/**
+ * @file StarBPlusTree.tpp
+ * @brief Implementación de la variante B*+ (StarBPlusTree).
+ * @details Las claves viven solo en las hojas, que forman una lista doblemente enlazada;
+ * los nodos internos guardan copias de la primera clave de cada subárbol derecho.
+ * Un hijo desbordado se resuelve como en StarBTree, según la política Desborde (ver
+ * Reorganizacion::Desbordar).
+ * @tparam Type Tipo de los elementos almacenados en el árbol.
+ * @tparam grado Grado del árbol (número máximo de claves por nodo excepto la raíz).
+ * @tparam Traza Política que recibe los eventos estructurales (TrazaNula por defecto).
+ * @tparam Asignador Política de memoria de los nodos (PoolNodos por defecto).
+ * @tparam Compare Orden estricto de las claves (std::less<Type> por defecto).
+ * @tparam Desborde Política de desborde (DesbordeVecino por defecto).
+ */
+
+/**
+ * @brief Constructor por defecto del Árbol B*+.
+ * @param comparar Orden de las claves.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::StarBPlusTree(const Compare& comparar) : cantElem(0), raiz(nullptr), comparar(comparar) {}
+
+/**
+ * @brief Constructor por copia.
+ * @param c Árbol B*+ a copiar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::StarBPlusTree(const StarBPlusTree &c) : cantElem(c.cantElem), raiz(nullptr), comparar(c.comparar) {
+    Hoja* previa = nullptr;
+    raiz = CopiarArbol(c.raiz, previa);
+}
+
+/**
+ * @brief Operador de asignación por copia.
+ * @param c Árbol B*+ a asignar.
+ * @return Referencia al objeto actual.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>& StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::operator=(const StarBPlusTree &c) {
+    if(this != &c) {
+        Vaciar();
+        Hoja* previa = nullptr;
+        raiz = CopiarArbol(c.raiz, previa);
+        cantElem = c.cantElem;
+        comparar = c.comparar;
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor del Árbol B*+.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::~StarBPlusTree() {
+    Vaciar();
+}
+
+/**
+ * @brief Copia un subárbol y reconstruye los enlaces entre hojas.
+ * @param subraiz Nodo raíz del subárbol a copiar.
+ * @param previa Última hoja copiada hasta el momento (se actualiza).
+ * @return Puntero al nuevo subárbol copiado.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Nodo*
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::CopiarArbol(const Nodo* subraiz, Hoja*& previa) {
+    if(subraiz == nullptr) return nullptr;
+
+    if(subraiz->hoja) {
+        Hoja* nueva = asignadorHoja.Crear();
+        nueva->elemNodo = subraiz->elemNodo;
+        for(int i = 0; i < subraiz->elemNodo; ++i) {
+            nueva->claves[i] = subraiz->claves[i];
+        }
+        nueva->anterior = previa;
+        if(previa != nullptr) previa->siguiente = nueva;
+        previa = nueva;
+        return nueva;
+    }
+
+    const Interno* origen = ComoInterno(subraiz);
+    Interno* nuevo = asignadorInterno.Crear();
+    nuevo->elemNodo = origen->elemNodo;
+    for(int i = 0; i < origen->elemNodo; ++i) {
+        nuevo->claves[i] = origen->claves[i];
+    }
+    for(int i = 0; i <= origen->elemNodo; ++i) {
+        nuevo->hijo[i] = CopiarArbol(origen->hijo[i], previa);
+    }
+    return nuevo;
+}
+
+/**
+ * @brief Inserta un nuevo valor en el árbol.
+ * @param valor Valor a insertar.
+ * @note Si el valor ya existe, no se inserta.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Agregar(Type valor) {
+    Insertar(std::move(valor));
+}
+
+/**
+ * @brief Inserta un valor con un único descenso desde la raíz.
+ * @param valor Valor a insertar.
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+bool StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Insertar(Type valor) {
+    if (raiz == nullptr) raiz = asignadorHoja.Crear();
+
+    if (!Agregar(valor, raiz)) return false;
+
+    if (raiz->elemNodo == grado) DividirRaiz();
+    return true;
+}
+
+/**
+ * @brief Inserta recursivamente un valor en el subárbol dado.
+ * @param valor Valor a insertar; se mueve a la hoja solo si no estaba.
+ * @param subraiz Nodo raíz del subárbol donde insertar.
+ * @return true si se insertó, false si el valor ya existía.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+bool StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Agregar(Type& valor, Nodo* subraiz) {
+    if (subraiz->hoja) {
+        int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valor, comparar);
+        if (i < subraiz->elemNodo && !comparar(valor, subraiz->claves[i])) return false;
+
+        for (int j = subraiz->elemNodo; j > i; --j) {
+            Mover(subraiz, j, subraiz, j - 1);
+        }
+        subraiz->claves[i] = std::move(valor);
+        subraiz->elemNodo++;
+        cantElem++;
+        return true;
+    }
+
+    Interno* nodo = ComoInterno(subraiz);
+    int i = IndiceHijo(nodo, valor);
+
+    Notificar(TipoEvento::Descenso, i);
+    if (!Agregar(valor, nodo->hijo[i])) return false;
+
+    if (nodo->hijo[i]->elemNodo == grado) {
+        OrdenarNodo(nodo, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Reorganiza o divide un hijo que ha alcanzado su capacidad máxima.
+ *
+ * Según la política de desborde, primero intenta redistribuir con los hermanos; si no
+ * hay lugar, divide el hijo en dos o, junto con un hermano adyacente, en tres.
+ *
+ * @param padre Nodo padre del hijo lleno.
+ * @param indiceHijo Índice del hijo que está lleno.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::OrdenarNodo(Interno* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(
+        indiceHijo, padre->elemNodo, grado, [padre](int i) { return padre->hijo[i]->elemNodo; });
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada: Redistribuir(padre, indiceHijo, plan.indice); break;
+        case Reorganizacion::Accion::Nivelar: RedistribuirVecino(padre, indiceHijo, plan.indice); break;
+        case Reorganizacion::Accion::DividirTriple: DividirTriple(padre, indiceHijo, plan.indice); break;
+        default: DividirDoble(padre, indiceHijo); break;
+    }
+}
+
+/**
+ * @brief Pasa la mitad derecha de un nodo lleno a un nodo nuevo.
+ *
+ * La separadora que debe subir al padre queda en nodo->claves[nodo->elemNodo]: entre
+ * hojas es una copia de la primera clave de la nueva, que se enlaza a continuación del
+ * nodo; entre nodos internos es la clave del medio.
+ *
+ * @param nodo Nodo con grado claves.
+ * @return El nodo nuevo con las claves mayores.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Nodo* StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::PartirMitad(Nodo* nodo) {
+    int clavesI = Reorganizacion::Mitad(grado);
+
+    if (nodo->hoja) {
+        Hoja* izquierda = ComoHoja(nodo);
+        Hoja* derecha = asignadorHoja.Crear();
+        for (int i = clavesI; i < grado; ++i) {
+            Mover(derecha, i - clavesI, izquierda, i);
+        }
+        derecha->elemNodo = grado - clavesI;
+        izquierda->elemNodo = clavesI;
+        izquierda->claves[clavesI] = derecha->claves[0];
+
+        derecha->anterior = izquierda;
+        derecha->siguiente = izquierda->siguiente;
+        if (izquierda->siguiente != nullptr) izquierda->siguiente->anterior = derecha;
+        izquierda->siguiente = derecha;
+        return derecha;
+    }
+
+    Interno* izquierdo = ComoInterno(nodo);
+    Interno* derecho = asignadorInterno.Crear();
+    int clavesD = grado - clavesI - 1;
+    for (int i = 0; i < clavesD; ++i) {
+        Mover(derecho, i, izquierdo, clavesI + 1 + i);
+    }
+    for (int i = 0; i <= clavesD; ++i) {
+        derecho->hijo[i] = izquierdo->hijo[clavesI + 1 + i];
+        izquierdo->hijo[clavesI + 1 + i] = nullptr;
+    }
+    derecho->elemNodo = clavesD;
+    izquierdo->elemNodo = clavesI;
+    return derecho;
+}
+
+/**
+ * @brief Divide la raíz llena en dos nodos bajo una nueva raíz interna.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::DividirRaiz() {
+    Notificar(TipoEvento::DivisionRaiz, -1);
+
+    Nodo* izquierdo = raiz;
+    Nodo* derecho = PartirMitad(izquierdo);
+
+    Interno* nueva = asignadorInterno.Crear();
+    Mover(nueva, 0, izquierdo, izquierdo->elemNodo);
+    nueva->elemNodo = 1;
+    nueva->hijo[0] = izquierdo;
+    nueva->hijo[1] = derecho;
+    raiz = nueva;
+}
+
+/**
+ * @brief Desplaza una clave en cascada desde un hijo lleno hasta un hermano con lugar.
+ *
+ * Igual que en StarBTree: la clave atraviesa los hermanos intermedios.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo que está lleno.
+ * @param hermano Hermano con lugar más cercano (ver Reorganizacion::Desbordar).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Redistribuir(Interno* padre, int indiceHijo, int hermano) {
+    if (hermano < indiceHijo) {
+        Notificar(TipoEvento::RedistribucionIzquierda, indiceHijo, hermano);
+        for (int j = hermano; j < indiceHijo; ++j) {
+            RotarIzquierda(padre, j);
+        }
+    } else {
+        Notificar(TipoEvento::RedistribucionDerecha, indiceHijo, hermano);
+        for (int j = hermano; j > indiceHijo; --j) {
+            RotarDerecha(padre, j - 1);
+        }
+    }
+}
+
+/**
+ * @brief Reparte un hijo lleno con un hermano adyacente que tenga lugar.
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo que está lleno.
+ * @param indice Separadora entre el hijo y el vecino (indiceHijo - 1 o indiceHijo).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::RedistribuirVecino(Interno* padre, int indiceHijo, int indice) {
+    if (indice < indiceHijo) {
+        Notificar(TipoEvento::RedistribucionIzquierda, indiceHijo, indice);
+    } else {
+        Notificar(TipoEvento::RedistribucionDerecha, indiceHijo, indice + 1);
+    }
+    Nivelar(padre, indice);
+}
+
+/**
+ * @brief Deja hijo[indice] e hijo[indice + 1] con la misma cantidad de claves (±1).
+ *
+ * Cada clave se mueve una sola vez. Entre hojas las claves pasan directamente y la
+ * separadora pasa a ser una copia de la nueva primera clave del derecho; entre nodos
+ * internos las que cruzan pasan por la separadora del padre, como en StarBTree.
+ *
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Nivelar(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+    int n = izquierdo->elemNodo;
+    int m = derecho->elemNodo;
+    int k = Reorganizacion::Mitad(n + m) - n; // Claves que ganará el izquierdo (negativo: que cederá)
+
+    if (izquierdo->hoja) {
+        if (k > 0) {
+            for (int j = 0; j < k; ++j) {
+                Mover(izquierdo, n + j, derecho, j);
+            }
+            for (int j = k; j < m; ++j) {
+                Mover(derecho, j - k, derecho, j);
+            }
+        } else if (k < 0) {
+            k = -k;
+            for (int j = m - 1; j >= 0; --j) {
+                Mover(derecho, j + k, derecho, j);
+            }
+            for (int j = 0; j < k; ++j) {
+                Mover(derecho, j, izquierdo, n - k + j);
+            }
+        }
+        izquierdo->elemNodo = Reorganizacion::Mitad(n + m);
+        derecho->elemNodo = n + m - izquierdo->elemNodo;
+        padre->claves[indice] = derecho->claves[0];
+        return;
+    }
+
+    Interno* iz = ComoInterno(izquierdo);
+    Interno* de = ComoInterno(derecho);
+    if (k > 0) {
+        // La separadora y k - 1 claves del derecho al izquierdo; la k-ésima sube al padre
+        Mover(iz, n, padre, indice);
+        for (int j = 0; j < k - 1; ++j) {
+            Mover(iz, n + 1 + j, de, j);
+        }
+        Mover(padre, indice, de, k - 1);
+        for (int j = k; j < m; ++j) {
+            Mover(de, j - k, de, j);
+        }
+        for (int j = 0; j < k; ++j) {
+            iz->hijo[n + 1 + j] = de->hijo[j];
+        }
+        for (int j = k; j <= m; ++j) {
+            de->hijo[j - k] = de->hijo[j];
+        }
+        for (int j = m - k + 1; j <= m; ++j) de->hijo[j] = nullptr;
+    } else if (k < 0) {
+        k = -k;
+        // Abrir k lugares al principio del derecho
+        for (int j = m - 1; j >= 0; --j) {
+            Mover(de, j + k, de, j);
+        }
+        Mover(de, k - 1, padre, indice);
+        for (int j = 0; j < k - 1; ++j) {
+            Mover(de, j, iz, n - k + 1 + j);
+        }
+        Mover(padre, indice, iz, n - k);
+        for (int j = m; j >= 0; --j) {
+            de->hijo[j + k] = de->hijo[j];
+        }
+        for (int j = 0; j < k; ++j) {
+            de->hijo[j] = iz->hijo[n - k + 1 + j];
+            iz->hijo[n - k + 1 + j] = nullptr;
+        }
+    }
+    izquierdo->elemNodo = Reorganizacion::Mitad(n + m);
+    derecho->elemNodo = n + m - izquierdo->elemNodo;
+}
+
+/**
+ * @brief Pasa la primera clave de hijo[indice + 1] a hijo[indice].
+ *
+ * Entre hojas la clave se mueve directamente y la separadora pasa a ser la nueva
+ * primera clave del derecho; entre nodos internos la clave rota a través del padre.
+ *
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::RotarIzquierda(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+
+    if (izquierdo->hoja) {
+        Mover(izquierdo, izquierdo->elemNodo++, derecho, 0);
+    } else {
+        Mover(izquierdo, izquierdo->elemNodo, padre, indice);
+        ComoInterno(izquierdo)->hijo[izquierdo->elemNodo + 1] = ComoInterno(derecho)->hijo[0];
+        izquierdo->elemNodo++;
+        Mover(padre, indice, derecho, 0);
+    }
+
+    for (int j = 0; j < derecho->elemNodo - 1; ++j) {
+        Mover(derecho, j, derecho, j + 1);
+    }
+    if (!derecho->hoja) {
+        Interno* d = ComoInterno(derecho);
+        for (int j = 0; j < d->elemNodo; ++j) {
+            d->hijo[j] = d->hijo[j + 1];
+        }
+        d->hijo[d->elemNodo] = nullptr;
+    }
+    derecho->elemNodo--;
+
+    if (derecho->hoja) padre->claves[indice] = derecho->claves[0];
+}
+
+/**
+ * @brief Pasa la última clave de hijo[indice] a hijo[indice + 1].
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::RotarDerecha(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+
+    for (int j = derecho->elemNodo; j > 0; --j) {
+        Mover(derecho, j, derecho, j - 1);
+    }
+
+    if (derecho->hoja) {
+        Mover(derecho, 0, izquierdo, izquierdo->elemNodo - 1);
+        padre->claves[indice] = derecho->claves[0];
+    } else {
+        Interno* d = ComoInterno(derecho);
+        Interno* iz = ComoInterno(izquierdo);
+        for (int j = d->elemNodo + 1; j > 0; --j) {
+            d->hijo[j] = d->hijo[j - 1];
+        }
+        Mover(d, 0, padre, indice);
+        d->hijo[0] = iz->hijo[iz->elemNodo];
+        iz->hijo[iz->elemNodo] = nullptr;
+        Mover(padre, indice, iz, iz->elemNodo - 1);
+    }
+    derecho->elemNodo++;
+    izquierdo->elemNodo--;
+}
+
+/**
+ * @brief Realiza una división triple de un hijo lleno y un hermano adyacente.
+ *
+ * Las hojas reparten sus claves en tres hojas enlazadas y suben copias de las primeras
+ * claves; los nodos internos reparten también la separadora, como en StarBTree.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo lleno.
+ * @param posFusion Separadora entre el hijo y el hermano elegido (ver Reorganizacion::Desbordar).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::DividirTriple(Interno* padre, int indiceHijo, int posFusion) {
+    Notificar(TipoEvento::DivisionTriple, indiceHijo, (posFusion < indiceHijo) ? posFusion : posFusion + 1);
+
+    Nodo* A = padre->hijo[posFusion];
+    Nodo* C = padre->hijo[posFusion + 1];
+    Nodo* B;
+    Type sepAB, sepBC;
+
+    std::vector<Type> fusion;
+    fusion.reserve(A->elemNodo + C->elemNodo + 1);
+    for (int i = 0; i < A->elemNodo; ++i)
+        fusion.push_back(std::move(A->claves[i]));
+    if (!A->hoja)
+        fusion.push_back(std::move(padre->claves[posFusion]));
+    for (int i = 0; i < C->elemNodo; ++i)
+        fusion.push_back(std::move(C->claves[i]));
+
+    int total = fusion.size();
+
+    if (A->hoja) {
+        Hoja* hA = ComoHoja(A);
+        Hoja* hC = ComoHoja(C);
+        Hoja* hB = asignadorHoja.Crear();
+
+        Reorganizacion::Tercios tercios = Reorganizacion::Triple(total);
+        int clavesA = tercios.a;
+        int clavesB = tercios.b;
+        int clavesC = tercios.c;
+
+        int idx = 0;
+        for (int i = 0; i < clavesA; ++i) hA->claves[i] = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesB; ++i) hB->claves[i] = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesC; ++i) hC->claves[i] = std::move(fusion[idx++]);
+        hA->elemNodo = clavesA;
+        hB->elemNodo = clavesB;
+        hC->elemNodo = clavesC;
+
+        hB->anterior = hA;
+        hB->siguiente = hC;
+        hA->siguiente = hB;
+        hC->anterior = hB;
+
+        sepAB = hB->claves[0];
+        sepBC = hC->claves[0];
+        B = hB;
+    } else {
+        Interno* iA = ComoInterno(A);
+        Interno* iC = ComoInterno(C);
+        Interno* iB = asignadorInterno.Crear();
+
+        std::vector<Nodo*> fusionHijos;
+        for (int i = 0; i <= iA->elemNodo; ++i)
+            fusionHijos.push_back(iA->hijo[i]);
+        for (int i = 0; i <= iC->elemNodo; ++i)
+            fusionHijos.push_back(iC->hijo[i]);
+
+        Reorganizacion::Tercios tercios = Reorganizacion::Triple(total - 2);
+        int clavesA = tercios.a;
+        int clavesB = tercios.b;
+        int clavesC = tercios.c;
+
+        int idx = 0;
+        for (int i = 0; i < clavesA; ++i) iA->claves[i] = std::move(fusion[idx++]);
+        sepAB = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesB; ++i) iB->claves[i] = std::move(fusion[idx++]);
+        sepBC = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesC; ++i) iC->claves[i] = std::move(fusion[idx++]);
+        iA->elemNodo = clavesA;
+        iB->elemNodo = clavesB;
+        iC->elemNodo = clavesC;
+
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            iA->hijo[i] = (i <= clavesA) ? fusionHijos[idx++] : nullptr;
+        for (int i = 0; i <= clavesB; ++i)
+            iB->hijo[i] = fusionHijos[idx++];
+        for (int i = 0; i <= grado; ++i)
+            iC->hijo[i] = (i <= clavesC) ? fusionHijos[idx++] : nullptr;
+        B = iB;
+    }
+
+    // Desplazar claves y punteros en padre para abrir lugar a B
+    for (int i = padre->elemNodo; i > posFusion + 1; --i) {
+        Mover(padre, i, padre, i - 1);
+        padre->hijo[i + 1] = padre->hijo[i];
+    }
+    padre->elemNodo++;
+
+    padre->claves[posFusion] = std::move(sepAB);
+    padre->claves[posFusion + 1] = std::move(sepBC);
+    padre->hijo[posFusion + 1] = B;
+    padre->hijo[posFusion + 2] = C;
+}
+
+/**
+ * @brief Divide un hijo lleno en dos, como un Árbol B+ clásico.
+ *
+ * El hijo conserva la mitad izquierda, un nodo nuevo recibe la derecha y el padre gana
+ * la separadora y el nuevo hijo. No mira a los hermanos.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo lleno.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::DividirDoble(Interno* padre, int indiceHijo) {
+    Notificar(TipoEvento::DivisionDoble, indiceHijo);
+
+    Nodo* izquierdo = padre->hijo[indiceHijo];
+    Nodo* derecho = PartirMitad(izquierdo);
+
+    // Abrir lugar en el padre para la separadora y el nuevo hijo
+    for (int i = padre->elemNodo; i > indiceHijo; --i) {
+        Mover(padre, i, padre, i - 1);
+        padre->hijo[i + 1] = padre->hijo[i];
+    }
+    padre->elemNodo++;
+
+    Mover(padre, indiceHijo, izquierdo, izquierdo->elemNodo);
+    padre->hijo[indiceHijo + 1] = derecho;
+}
+
+/**
+ * @brief Elimina un valor del árbol.
+ * @param valor Valor a eliminar.
+ * @return true si el valor existía y se eliminó, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+bool StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Eliminar(const Type& valor) {
+    if (raiz == nullptr) return false;
+
+    if (!Eliminar(valor, raiz)) return false;
+
+    if (raiz->elemNodo == 0) {
+        Nodo* vieja = raiz;
+        raiz = vieja->hoja ? nullptr : ComoInterno(vieja)->hijo[0];
+        Destruir(vieja);
+        Notificar(TipoEvento::ContraccionRaiz, -1);
+    }
+    return true;
+}
+
+/**
+ * @brief Elimina recursivamente un valor del subárbol dado.
+ *
+ * Las separadoras de los nodos internos pueden quedar como copias de claves ya
+ * eliminadas; siguen siendo cotas válidas para el descenso.
+ *
+ * @param valor Valor a eliminar.
+ * @param subraiz Nodo raíz del subárbol.
+ * @return true si el valor se eliminó, false si no existía.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+bool StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Eliminar(const Type& valor, Nodo* subraiz) {
+    if (subraiz->hoja) {
+        int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valor, comparar);
+        if (i == subraiz->elemNodo || comparar(valor, subraiz->claves[i])) return false;
+
+        for (int j = i; j < subraiz->elemNodo - 1; ++j) {
+            Mover(subraiz, j, subraiz, j + 1);
+        }
+        subraiz->elemNodo--;
+        cantElem--;
+        return true;
+    }
+
+    Interno* nodo = ComoInterno(subraiz);
+    int i = IndiceHijo(nodo, valor);
+    if (!Eliminar(valor, nodo->hijo[i])) return false;
+
+    if (nodo->hijo[i]->elemNodo < minClaves) {
+        CorregirSubflujo(nodo, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Corrige un hijo que quedó con menos claves que el mínimo.
+ *
+ * Pide prestado en cascada al hermano más cercano con claves de sobra; si ninguno
+ * puede prestar, fusiona tres hermanos en dos (o los dos hijos de la raíz en uno).
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo con subflujo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::CorregirSubflujo(Interno* padre, int indiceHijo) {
+    // Las hojas no bajan la separadora, así que caben con una clave más
+    Reorganizacion::Plan plan = Reorganizacion::Subflujo(
+        indiceHijo, padre->elemNodo, grado, [padre](int i) { return padre->hijo[i]->elemNodo; },
+        !padre->hijo[0]->hoja);
+    int i = plan.indice;
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada:
+            if (i < indiceHijo) {
+                Notificar(TipoEvento::RedistribucionDerecha, i, indiceHijo);
+                for (int j = i; j < indiceHijo; ++j) {
+                    RotarDerecha(padre, j);
+                }
+            } else {
+                Notificar(TipoEvento::RedistribucionIzquierda, i, indiceHijo);
+                for (int j = i - 1; j >= indiceHijo; --j) {
+                    RotarIzquierda(padre, j);
+                }
+            }
+            break;
+        case Reorganizacion::Accion::FusionarTriple: FusionarTriple(padre, i); break;
+        case Reorganizacion::Accion::FusionarDoble: FusionarDoble(padre); break;
+        default: break;
+    }
+}
+
+/**
+ * @brief Fusiona tres hermanos consecutivos en dos.
+ * @param padre Nodo padre.
+ * @param inicio Índice del primero de los tres hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::FusionarTriple(Interno* padre, int inicio) {
+    Notificar(TipoEvento::Fusion, inicio, inicio + 2);
+
+    Nodo* nodos[3] = {padre->hijo[inicio], padre->hijo[inicio + 1], padre->hijo[inicio + 2]};
+    bool hoja = nodos[0]->hoja;
+
+    std::vector<Type> fusion;
+    std::vector<Nodo*> fusionHijos;
+    fusion.reserve(nodos[0]->elemNodo + nodos[1]->elemNodo + nodos[2]->elemNodo + 2);
+    for (int k = 0; k < 3; ++k) {
+        for (int i = 0; i < nodos[k]->elemNodo; ++i)
+            fusion.push_back(std::move(nodos[k]->claves[i]));
+        if (!hoja) {
+            if (k < 2) fusion.push_back(std::move(padre->claves[inicio + k]));
+            for (int i = 0; i <= nodos[k]->elemNodo; ++i)
+                fusionHijos.push_back(ComoInterno(nodos[k])->hijo[i]);
+        }
+    }
+
+    int total = fusion.size();
+    int clavesA, clavesB;
+    int idx = 0;
+
+    if (hoja) {
+        clavesA = Reorganizacion::Mitad(total);
+        clavesB = total - clavesA;
+        for (int i = 0; i < clavesA; ++i) nodos[0]->claves[i] = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesB; ++i) nodos[1]->claves[i] = std::move(fusion[idx++]);
+        padre->claves[inicio] = nodos[1]->claves[0];
+
+        Hoja* hB = ComoHoja(nodos[1]);
+        Hoja* hC = ComoHoja(nodos[2]);
+        hB->siguiente = hC->siguiente;
+        if (hC->siguiente != nullptr) hC->siguiente->anterior = hB;
+    } else {
+        clavesA = Reorganizacion::Mitad(total - 1);
+        clavesB = total - 1 - clavesA;
+        for (int i = 0; i < clavesA; ++i) nodos[0]->claves[i] = std::move(fusion[idx++]);
+        padre->claves[inicio] = std::move(fusion[idx++]);
+        for (int i = 0; i < clavesB; ++i) nodos[1]->claves[i] = std::move(fusion[idx++]);
+
+        Interno* iA = ComoInterno(nodos[0]);
+        Interno* iB = ComoInterno(nodos[1]);
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            iA->hijo[i] = (i <= clavesA) ? fusionHijos[idx++] : nullptr;
+        for (int i = 0; i <= grado; ++i)
+            iB->hijo[i] = (i <= clavesB) ? fusionHijos[idx++] : nullptr;
+    }
+    nodos[0]->elemNodo = clavesA;
+    nodos[1]->elemNodo = clavesB;
+
+    for (int i = inicio + 1; i < padre->elemNodo - 1; ++i) {
+        Mover(padre, i, padre, i + 1);
+        padre->hijo[i + 1] = padre->hijo[i + 2];
+    }
+    padre->hijo[padre->elemNodo] = nullptr;
+    padre->elemNodo--;
+
+    Destruir(nodos[2]);
+}
+
+/**
+ * @brief Fusiona los dos únicos hijos de un nodo en uno solo.
+ * @param padre Nodo padre con exactamente dos hijos (la raíz).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::FusionarDoble(Interno* padre) {
+    Notificar(TipoEvento::Fusion, 0, 1);
+
+    Nodo* A = padre->hijo[0];
+    Nodo* B = padre->hijo[1];
+
+    if (A->hoja) {
+        for (int i = 0; i < B->elemNodo; ++i) {
+            Mover(A, A->elemNodo + i, B, i);
+        }
+        A->elemNodo += B->elemNodo;
+
+        Hoja* hA = ComoHoja(A);
+        Hoja* hB = ComoHoja(B);
+        hA->siguiente = hB->siguiente;
+        if (hB->siguiente != nullptr) hB->siguiente->anterior = hA;
+    } else {
+        Interno* iA = ComoInterno(A);
+        Interno* iB = ComoInterno(B);
+        Mover(iA, iA->elemNodo, padre, 0);
+        for (int i = 0; i < iB->elemNodo; ++i) {
+            Mover(iA, iA->elemNodo + 1 + i, iB, i);
+        }
+        for (int i = 0; i <= iB->elemNodo; ++i) {
+            iA->hijo[iA->elemNodo + 1 + i] = iB->hijo[i];
+        }
+        iA->elemNodo += iB->elemNodo + 1;
+    }
+
+    padre->hijo[1] = nullptr;
+    padre->elemNodo = 0;
+
+    Destruir(B);
+}
+
+/**
+ * @brief Índice del hijo por el que se debe bajar para valor.
+ *
+ * Cada separadora es la primera clave de su subárbol derecho, por lo que una
+ * coincidencia exacta baja a la derecha.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+int StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::IndiceHijo(const Interno* nodo, const Type& valor) const {
+    int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+    if (i < nodo->elemNodo && !comparar(valor, nodo->claves[i])) ++i;
+    return i;
+}
+
+/**
+ * @brief Baja desde la raíz hasta la hoja que debe contener valor.
+ * @return La hoja, o nullptr si el árbol está vacío.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+const typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Hoja*
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::BuscarHoja(const Type& valor) const {
+    const Nodo* nodo = raiz;
+    if (nodo == nullptr) return nullptr;
+    while (!nodo->hoja) {
+        const Interno* interno = ComoInterno(nodo);
+        nodo = interno->hijo[IndiceHijo(interno, valor)];
+    }
+    return ComoHoja(nodo);
+}
+
+/**
+ * @brief Hoja con las claves menores, o nullptr si el árbol está vacío.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+const typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Hoja*
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::PrimeraHoja() const {
+    const Nodo* nodo = raiz;
+    if (nodo == nullptr) return nullptr;
+    while (!nodo->hoja) nodo = ComoInterno(nodo)->hijo[0];
+    return ComoHoja(nodo);
+}
+
+/**
+ * @brief Hoja con las claves mayores, o nullptr si el árbol está vacío.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+const typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Hoja*
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::UltimaHoja() const {
+    const Nodo* nodo = raiz;
+    if (nodo == nullptr) return nullptr;
+    while (!nodo->hoja) nodo = ComoInterno(nodo)->hijo[nodo->elemNodo];
+    return ComoHoja(nodo);
+}
+
+/**
+ * @brief Busca un valor en el árbol.
+ * @param valor Valor a buscar.
+ * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+bool StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Buscar(const Type& valor) const {
+    const Hoja* hoja = BuscarHoja(valor);
+    if (hoja == nullptr) return false;
+    int i = Busqueda::Posicion(hoja->claves, hoja->elemNodo, valor, comparar);
+    return i < hoja->elemNodo && !comparar(valor, hoja->claves[i]);
+}
+
+/**
+ * @brief Iterador al menor elemento del árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::begin() const {
+    return const_iterator(this, PrimeraHoja(), 0);
+}
+
+/**
+ * @brief Iterador al final (una posición después del mayor elemento).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::end() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+/**
+ * @brief Iterador inverso al mayor elemento del árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_reverse_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+/**
+ * @brief Iterador inverso al final del recorrido descendente.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_reverse_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+/**
+ * @brief Busca el primer elemento que no es menor que valor.
+ * @return Iterador al elemento, o end() si todos son menores.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::lower_bound(const Type& valor) const {
+    const Hoja* hoja = BuscarHoja(valor);
+    if (hoja == nullptr) return end();
+    int i = Busqueda::Posicion(hoja->claves, hoja->elemNodo, valor, comparar);
+    if (i == hoja->elemNodo) return const_iterator(this, hoja->siguiente, 0);
+    return const_iterator(this, hoja, i);
+}
+
+/**
+ * @brief Busca el primer elemento mayor que valor.
+ * @return Iterador al elemento, o end() si ninguno es mayor.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::upper_bound(const Type& valor) const {
+    const_iterator it = lower_bound(valor);
+    if (it != end() && !comparar(valor, *it)) ++it;
+    return it;
+}
+
+/**
+ * @brief Rango de elementos equivalentes a valor (a lo sumo uno, las claves son únicas).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+std::pair<typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator,
+          typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator>
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::equal_range(const Type& valor) const {
+    return std::make_pair(lower_bound(valor), upper_bound(valor));
+}
+
+/**
+ * @brief Visita en orden ascendente los elementos del intervalo cerrado [desde, hasta].
+ *
+ * Un solo descenso ubica la primera hoja; luego se avanza por los enlaces entre hojas.
+ * Si fn devuelve bool, un valor false detiene el recorrido.
+ *
+ * @param desde Límite inferior (incluido).
+ * @param hasta Límite superior (incluido).
+ * @param fn Función invocada con cada elemento.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+template <typename Funcion>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const {
+    if (comparar(hasta, desde)) return;
+    const Hoja* hoja = BuscarHoja(desde);
+    if (hoja == nullptr) return;
+
+    int i = Busqueda::Posicion(hoja->claves, hoja->elemNodo, desde, comparar);
+    for (; hoja != nullptr; hoja = hoja->siguiente, i = 0) {
+        for (; i < hoja->elemNodo; ++i) {
+            if (comparar(hasta, hoja->claves[i])) return;
+
+            if constexpr (std::is_same<decltype(fn(hoja->claves[i])), bool>::value) {
+                if (!fn(hoja->claves[i])) return;
+            } else {
+                fn(hoja->claves[i]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Avanza al sucesor en orden, pasando a la hoja siguiente si hace falta.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator&
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator::operator++() {
+    if (++indice == hoja->elemNodo) {
+        hoja = hoja->siguiente;
+        indice = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Retrocede al predecesor en orden; desde end() va al mayor elemento.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+typename StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator&
+StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::const_iterator::operator--() {
+    if (hoja == nullptr) {
+        hoja = arbol->UltimaHoja();
+        indice = hoja->elemNodo - 1;
+    } else if (indice > 0) {
+        --indice;
+    } else {
+        hoja = hoja->anterior;
+        indice = hoja->elemNodo - 1;
+    }
+    return *this;
+}
+
+/**
+ * @brief Elimina todos los elementos del árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Vaciar() {
+    if constexpr (!(Asignador<Hoja>::liberacionMasiva && std::is_trivially_destructible<Type>::value)) {
+        Vaciar(raiz);
+    }
+    asignadorInterno.LiberarTodo();
+    asignadorHoja.LiberarTodo();
+    raiz = nullptr;
+    cantElem = 0;
+}
+
+/**
+ * @brief Elimina todos los nodos del subárbol de forma recursiva.
+ * @param nodo Nodo raíz del subárbol a eliminar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Vaciar(Nodo* nodo) {
+    if (nodo == nullptr) return;
+
+    if (!nodo->hoja) {
+        Interno* interno = ComoInterno(nodo);
+        for (int i = 0; i <= interno->elemNodo; ++i) {
+            Vaciar(interno->hijo[i]);
+        }
+    }
+    Destruir(nodo);
+}
+
+/**
+ * @brief Devuelve un nodo a la política de memoria que corresponde a su tipo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Destruir(Nodo* nodo) {
+    if (nodo->hoja) asignadorHoja.Destruir(ComoHoja(nodo));
+    else asignadorInterno.Destruir(ComoInterno(nodo));
+}
+
+/**
+ * @brief Imprime los elementos en orden ascendente recorriendo la lista de hojas.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::ImprimirAsc() const {
+    for (const Hoja* hoja = PrimeraHoja(); hoja != nullptr; hoja = hoja->siguiente) {
+        for (int i = 0; i < hoja->elemNodo; ++i) {
+            std::cout << hoja->claves[i] << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Imprime los elementos en orden descendente recorriendo la lista de hojas al revés.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::ImprimirDes() const {
+    for (const Hoja* hoja = UltimaHoja(); hoja != nullptr; hoja = hoja->anterior) {
+        for (int i = hoja->elemNodo - 1; i >= 0; --i) {
+            std::cout << hoja->claves[i] << " ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Imprime el árbol por niveles (recorrido por amplitud).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::ImprimirNiveles() const {
+    if(raiz == nullptr) return;
+
+    std::queue<const Nodo*> cola;
+    cola.push(raiz);
+
+    while(!cola.empty()) {
+        int tamanoNivel = cola.size();
+
+        for(int i = 0; i < tamanoNivel; ++i) {
+            const Nodo* actual = cola.front();
+            cola.pop();
+
+            std::cout << "[";
+            for(int j = 0; j < actual->elemNodo; ++j) {
+                std::cout << actual->claves[j];
+                if(j < actual->elemNodo-1) std::cout << " ";
+            }
+            std::cout << "] ";
+
+            if(!actual->hoja) {
+                for(int j = 0; j <= actual->elemNodo; ++j) {
+                    cola.push(ComoInterno(actual)->hijo[j]);
+                }
+            }
+        }
+        std::cout << std::endl;
+    }
+}
+
+/**
+ * @brief Devuelve la cantidad total de elementos en el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+int StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::CantElem() const {
+    return cantElem;
+}
+
+/**
+ * @brief Devuelve la política de traza asociada al árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+Traza& StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::ObtenerTraza() {
+    return traza;
+}
+
+/**
+ * @brief Entrega un evento estructural a la política de traza.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, typename Desborde>
+void StarBPlusTree<Type, grado, Traza, Asignador, Compare, Desborde>::Notificar(TipoEvento tipo, int indiceHijo, int indiceHermano) {
+    if constexpr (Traza::activa) {
+        traza.Notificar(EventoTraza{tipo, indiceHijo, indiceHermano});
+    }
+}
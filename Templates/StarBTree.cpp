@@ -1,7 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <queue>
+#include <vector>
 #include <cmath>
+#include <cstring>
+#include <fstream>
 #include <stdexcept>
+#include <type_traits>
 #include "../Headers/StarBTree.hpp"
 
 /**
@@ -10,13 +15,20 @@
  * @details Soporta inserción con redistribución, división triple y lógica especial para la raíz.
  * @tparam Type Tipo de los elementos almacenados en el árbol.
  * @tparam grado Grado del árbol (número máximo de claves por nodo excepto la raíz).
+ * @tparam Traza Política que recibe los eventos estructurales (TrazaNula por defecto).
+ * @tparam Asignador Política de memoria de los nodos (PoolNodos por defecto).
+ * @tparam Compare Orden estricto de las claves (std::less<Type> por defecto).
+ * @tparam conteos Si los nodos internos guardan la cantidad de elementos bajo cada hijo.
+ * @tparam Desborde Política para un hijo lleno al insertar (DesbordeVecino por defecto).
+ * @tparam Carga Dato asociado a cada clave, o void si el árbol guarda solo claves.
  */
 
 /**
  * @brief Constructor por defecto del Árbol B*.
+ * @param comparar Orden de las claves.
  */
-template <typename Type, int grado>
-StarBTree<Type, grado>::StarBTree() : cantElem(0), raiz(nullptr) {}
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::StarBTree(const Compare& comparar) : cantElem(0), raiz(nullptr), comparar(comparar), instantaneas(0) {}
 
 
 
@@ -24,30 +36,224 @@ StarBTree<Type, grado>::StarBTree() : cantElem(0), raiz(nullptr) {}
  * @brief Constructor por copia.
  * @param c Árbol B* a copiar.
  */
-template <typename Type, int grado>
-StarBTree<Type, grado>::StarBTree(const StarBTree &c) : raiz(CopiarArbol(c.raiz)), cantElem(c.cantElem) {}
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::StarBTree(const StarBTree &c)
+    : cantElem(c.cantElem), raiz(nullptr), comparar(c.comparar), instantaneas(0) {
+    // Después de inicializar instantaneas: CopiarArbol crea nodos y las consulta
+    raiz = CopiarArbol(c.raiz);
+}
+
+/**
+ * @brief Constructor por movimiento: toma los nodos de c sin copiarlos.
+ * @param c Árbol B* a mover (sin instantáneas vivas); queda vacío.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::StarBTree(StarBTree &&c) noexcept
+    : cantElem(c.cantElem), traza(std::move(c.traza)),
+      asignadorInterno(std::move(c.asignadorInterno)), asignadorHoja(std::move(c.asignadorHoja)),
+      raiz(c.raiz), comparar(std::move(c.comparar)), instantaneas(0) {
+    c.raiz = nullptr;
+    c.cantElem = 0;
+}
 
 /**
  * @brief Operador de asignación por copia.
  * @param c Árbol B* a asignar.
  * @return Referencia al objeto actual.
  */
-template <typename Type, int grado>
-StarBTree<Type, grado>& StarBTree<Type, grado>::operator=(const StarBTree &c) {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::operator=(const StarBTree &c) {
     if(this != &c) {
         Vaciar();
+        comparar = c.comparar;
         raiz = CopiarArbol(c.raiz);
         cantElem = c.cantElem;
     }
     return *this;
 }
 
+/**
+ * @brief Asignación por movimiento: libera el contenido actual y toma los nodos de c.
+ * @param c Árbol B* a mover (sin instantáneas vivas); queda vacío.
+ * @return Referencia al objeto actual.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::operator=(StarBTree &&c) noexcept {
+    if(this != &c) {
+        Vaciar();
+        traza = std::move(c.traza);
+        asignadorInterno = std::move(c.asignadorInterno);
+        asignadorHoja = std::move(c.asignadorHoja);
+        comparar = std::move(c.comparar);
+        raiz = c.raiz;
+        cantElem = c.cantElem;
+        c.raiz = nullptr;
+        c.cantElem = 0;
+    }
+    return *this;
+}
+
+/**
+ * @brief Constructor por carga masiva desde una secuencia ordenada.
+ * @param inicio Iterador al primer elemento.
+ * @param fin Iterador al final de la secuencia.
+ * @param llenado Fracción objetivo de llenado de cada nodo, en [2/3, 1].
+ * @see CargarOrdenado
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Iterador>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::StarBTree(Iterador inicio, Iterador fin, double llenado) : cantElem(0), raiz(nullptr), comparar(), instantaneas(0) {
+    CargarOrdenado(inicio, fin, llenado);
+}
+
 /**
  * @brief Destructor del Árbol B*.
  */
-template <typename Type, int grado>
-StarBTree<Type, grado>::~StarBTree() {
-    Vaciar(raiz);
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::~StarBTree() {
+    Vaciar();
+}
+
+/**
+ * @brief Obtiene un nodo vacío de la política de memoria que corresponde a su tipo.
+ * @param hoja true para una hoja, false para un nodo interno.
+ * @return Puntero al nuevo nodo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nodo* StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::CrearNodo(bool hoja) {
+    auto guardia = BloquearMemoria();
+    if (hoja) return asignadorHoja.Crear();
+    return asignadorInterno.Crear();
+}
+
+/**
+ * @brief Devuelve un nodo a la política de memoria que corresponde a su tipo.
+ * @param nodo Nodo a destruir.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Destruir(Nodo* nodo) {
+    auto guardia = BloquearMemoria();
+    if (nodo->hoja) asignadorHoja.Destruir(static_cast<Hoja*>(nodo));
+    else asignadorInterno.Destruir(ComoInterno(nodo));
+}
+
+/**
+ * @brief Toma el candado del pool solo si hay instantáneas que puedan liberar nodos desde otro hilo.
+ * @return Guardia del candado (vacía si no hace falta).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+std::unique_lock<std::mutex> StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::BloquearMemoria() {
+    if (instantaneas.load(std::memory_order_acquire) == 0) return std::unique_lock<std::mutex>();
+    return std::unique_lock<std::mutex>(candado);
+}
+
+/**
+ * @brief Indica si el nodo tiene más de una referencia (un padre y alguna instantánea).
+ *
+ * Sin instantáneas vivas ningún nodo está compartido y no se consulta la tabla.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Compartido(const Nodo* nodo) {
+    if (instantaneas.load(std::memory_order_acquire) == 0) return false;
+    std::lock_guard<std::mutex> guardia(candado);
+    return compartidos.count(nodo) != 0;
+}
+
+/**
+ * @brief Suma una referencia al nodo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Referenciar(const Nodo* nodo) {
+    std::lock_guard<std::mutex> guardia(candado);
+    ++compartidos[nodo];
+}
+
+/**
+ * @brief Resta una referencia al nodo.
+ *
+ * Siempre toma el candado: una instantánea puede terminar de liberarse mientras Duplicar
+ * reparte referencias, y la tabla queda entonces con entradas aunque ya no haya instantáneas.
+ *
+ * @return true si era la última y el nodo debe liberarse.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Desreferenciar(const Nodo* nodo) {
+    std::lock_guard<std::mutex> guardia(candado);
+    auto it = compartidos.find(nodo);
+    if (it == compartidos.end()) return true;
+    if (--it->second == 0) compartidos.erase(it);
+    return false;
+}
+
+/**
+ * @brief Quita una referencia al nodo; si era la última, libera el nodo y suelta sus hijos.
+ * @param nodo Nodo a soltar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Soltar(Nodo* nodo) {
+    if (!Desreferenciar(nodo)) return;
+
+    if (!EsHoja(nodo)) {
+        for (int i = 0; i <= nodo->elemNodo; ++i) {
+            Soltar(ComoInterno(nodo)->hijo[i]);
+        }
+    }
+    Destruir(nodo);
+}
+
+/**
+ * @brief Copia un nodo compartido para poder modificarlo.
+ *
+ * La copia apunta a los mismos hijos, que ganan una referencia; el original pierde la
+ * referencia que tenía desde el árbol.
+ *
+ * @param nodo Nodo compartido con alguna instantánea.
+ * @return Copia privada del nodo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nodo* StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Duplicar(Nodo* nodo) {
+    Nodo* copia = CrearNodo(nodo->hoja);
+    copia->elemNodo = nodo->elemNodo;
+    for (int i = 0; i < nodo->elemNodo; ++i) {
+        copia->claves[i] = nodo->claves[i];
+        if constexpr (conCarga) copia->cargas[i] = nodo->cargas[i];
+    }
+    if (!EsHoja(nodo)) {
+        for (int i = 0; i <= nodo->elemNodo; ++i) {
+            Nodo* hijo = ComoInterno(nodo)->hijo[i];
+            Referenciar(hijo);
+            ComoInterno(copia)->hijo[i] = hijo;
+            if constexpr (conteos) ComoInterno(copia)->conteo[i] = ComoInterno(nodo)->conteo[i];
+        }
+    }
+    Soltar(nodo);
+    return copia;
+}
+
+/**
+ * @brief Devuelve padre->hijo[indice] listo para modificar.
+ *
+ * Sin instantáneas el hijo ya es privado y no se toma el candado.
+ *
+ * @param padre Nodo padre, ya privado.
+ * @param indice Índice del hijo.
+ * @return El hijo, o su copia si lo compartía una instantánea.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nodo* StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Propio(Interno* padre, int indice) {
+    Nodo* hijo = padre->hijo[indice];
+    if (!Compartido(hijo)) return hijo;
+    return padre->hijo[indice] = Duplicar(hijo);
+}
+
+/**
+ * @brief Hace privados los hijos padre->hijo[desde..hasta] antes de una reorganización.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Propios(Interno* padre, int desde, int hasta) {
+    for (int i = desde; i <= hasta; ++i) {
+        Propio(padre, i);
+    }
 }
 
 /**
@@ -55,19 +261,23 @@ StarBTree<Type, grado>::~StarBTree() {
  * @param subraiz Puntero al nodo raíz del subárbol a copiar.
  * @return Puntero al nuevo subárbol copiado.
  */
-template <typename Type, int grado>
-typename StarBTree<Type, grado>::Nodo* StarBTree<Type, grado>::CopiarArbol(Nodo* subraiz) {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nodo* StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::CopiarArbol(Nodo* subraiz) {
     if(subraiz == nullptr) return nullptr;
     
-    Nodo* nuevoNodo = new Nodo();
+    Nodo* nuevoNodo = CrearNodo(subraiz->hoja);
     nuevoNodo->elemNodo = subraiz->elemNodo;
     
     for(int i = 0; i < subraiz->elemNodo; ++i) {
         nuevoNodo->claves[i] = subraiz->claves[i];
+        if constexpr (conCarga) nuevoNodo->cargas[i] = subraiz->cargas[i];
     }
     
-    for(int i = 0; i <= subraiz->elemNodo; ++i) {
-        nuevoNodo->hijo[i] = CopiarArbol(subraiz->hijo[i]);
+    if(!subraiz->hoja) {
+        for(int i = 0; i <= subraiz->elemNodo; ++i) {
+            ComoInterno(nuevoNodo)->hijo[i] = CopiarArbol(ComoInterno(subraiz)->hijo[i]);
+            if constexpr (conteos) ComoInterno(nuevoNodo)->conteo[i] = ComoInterno(subraiz)->conteo[i];
+        }
     }
     
     return nuevoNodo;
@@ -78,584 +288,1510 @@ typename StarBTree<Type, grado>::Nodo* StarBTree<Type, grado>::CopiarArbol(Nodo*
  * @param valor Valor a insertar.
  * @note Si el valor ya existe, no se inserta.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::Agregar(Type valor){
-    if (raiz == nullptr) raiz = new Nodo(/*true, true*/);  // raíz y hoja
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Agregar(Type valor){
+    Insertar(std::move(valor));
+}
 
-    if(Buscar(valor)){
-        std::cout << "El valor " << valor << " ya existe en el árbol" << std::endl;
-        return;
+/**
+ * @brief Inserta un valor con un único descenso desde la raíz.
+ *
+ * La detección de duplicados se hace durante el mismo recorrido que ubica la hoja,
+ * por lo que no se necesita una búsqueda previa.
+ *
+ * @param valor Valor a insertar; se mueve hasta la hoja (con una carga por defecto, si la hay).
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Insertar(Type valor){
+    if constexpr (conCarga) {
+        return InsertarEntrada(valor, [&valor]() { return Entrada{std::move(valor), Carga()}; });
+    } else {
+        return InsertarEntrada(valor, [&valor]() -> Type&& { return std::move(valor); });
+    }
+}
+
+/**
+ * @brief Inserta la entrada que arma crear() si la clave no estaba.
+ * @param valor Clave a ubicar; debe seguir válida hasta que crear() la consuma.
+ * @param crear Devuelve la entrada (clave y carga) a mover a la hoja; solo se llama si se inserta.
+ * @param posicion Si no es nulo, recibe la posición de la clave (la encontrada o la
+ * insertada), o end() si una reorganización pudo haberla movido.
+ * @return true si se insertó, false si la clave ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Crear>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::InsertarEntrada(const Type& valor, Crear crear, const_iterator* posicion){
+    if (raiz == nullptr) raiz = CrearNodo(true);  // raíz y hoja
+    else if (Compartido(raiz)) raiz = Duplicar(raiz);
+    if (posicion != nullptr) *posicion = const_iterator(raiz);
+
+    Contar(&ContadoresArbol::inserciones, 1);
+    if (!Agregar(valor, crear, raiz, posicion)) return false;
+
+    // La raíz no tiene hermanos: si se llena, se divide y el árbol crece
+    if (raiz->elemNodo == grado) {
+        DividirRaiz();
+        if (posicion != nullptr) *posicion = const_iterator(raiz);
+    }
+    return true;
+}
+
+/**
+ * @brief Construye un elemento a partir de args y lo inserta.
+ *
+ * El elemento se construye una sola vez y luego se mueve hasta la hoja; si ya existía
+ * una clave equivalente, se descarta.
+ *
+ * @param args Argumentos para el constructor de Type.
+ * @return true si el elemento se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename... Args>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Emplazar(Args&&... args){
+    return Insertar(Type(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief Ubica una clave, insertándola con una carga construida a partir de args si no estaba.
+ *
+ * Como try_emplace de std::map: si la clave ya existe, args no se usa. El mismo descenso
+ * que inserta arma el iterador; solo si la inserción reorganizó nodos (y pudo mover la
+ * clave) se la busca de nuevo.
+ *
+ * @param clave Clave a ubicar.
+ * @param args Argumentos para el constructor de Carga (ninguno sin carga).
+ * @return Par (iterador a la clave, con la carga modificable; true si se insertó).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename... Args>
+std::pair<typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::iterator, bool>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Colocar(const Type& clave, Args&&... args){
+    const_iterator it;
+    bool insertada;
+    if constexpr (conCarga) {
+        insertada = InsertarEntrada(clave, [&]() { return Entrada{clave, Carga(std::forward<Args>(args)...)}; }, &it);
+    } else {
+        static_assert(sizeof...(Args) == 0, "Sin carga no hay nada que construir");
+        insertada = InsertarEntrada(clave, [&clave]() { return Type(clave); }, &it);
     }
+    if (it == end()) it = lower_bound(clave);
+    return std::make_pair(Modificable(it), insertada);
+}
 
-    Agregar(valor, raiz);
+/**
+ * @brief Convierte una posición de este árbol en un iterador con la carga modificable.
+ * @param it Iterador de este árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::iterator
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Modificable(const_iterator it) {
+    return iterator(it);
+}
+
+/**
+ * @brief Inserta un lote de valores bajando por el árbol con todos a la vez.
+ *
+ * El lote se ordena y en cada nodo se reparte entre los hijos, de modo que cada nodo del
+ * camino se visita una vez por tramo y todos los valores de una hoja se mezclan en ella de
+ * una sola pasada. La hoja se reorganiza (redistribución o división triple) solo cuando se
+ * llena, no por cada valor.
+ *
+ * @param inicio Iterador al primer valor.
+ * @param fin Iterador al final del lote.
+ * @param ordenado true si el lote ya viene en orden ascendente (se omite el ordenamiento).
+ * @return Cantidad de valores que no estaban en el árbol.
+ * @throws std::invalid_argument Si ordenado es true y el lote no está ordenado.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Iterador>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::InsertarLote(Iterador inicio, Iterador fin, bool ordenado) {
+    std::vector<Type> valores(inicio, fin);
+    if (!ordenado) {
+        std::sort(valores.begin(), valores.end(), comparar);
+    } else if (!std::is_sorted(valores.begin(), valores.end(), comparar)) {
+        throw std::invalid_argument("El lote no está ordenado");
+    }
+    // Los equivalentes consecutivos se insertan una sola vez
+    valores.erase(std::unique(valores.begin(), valores.end(),
+                              [this](const Type& a, const Type& b) { return !comparar(a, b); }),
+                  valores.end());
+    if (valores.empty()) return 0;
+
+    if (raiz == nullptr) raiz = CrearNodo(true);
+    else if (Compartido(raiz)) raiz = Duplicar(raiz);
+
+    int antes = cantElem;
+    int n = valores.size();
+    Contar(&ContadoresArbol::inserciones, n);
+    int hecho = 0;
+    while (hecho < n) {
+        hecho += AgregarLote(valores.data() + hecho, n - hecho, raiz);
+        if (raiz->elemNodo == grado) DividirRaiz();
+    }
+    return cantElem - antes;
 }
 
 /**
  * @brief Inserta recursivamente un valor en el subárbol dado.
- * @param valor Valor a insertar.
+ * @param valor Clave a ubicar.
+ * @param crear Arma la entrada (clave y carga) a mover a la hoja; solo se llama si se inserta.
  * @param subraiz Puntero al nodo raíz del subárbol donde insertar.
+ * @param posicion Si no es nulo, se le apila el camino; queda en end() si se reorganizó un nodo.
+ * @return true si se insertó, false si la clave ya existía.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::Agregar(Type valor, Nodo* subraiz){
-    int i = subraiz->elemNodo - 1;
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Crear>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Agregar(const Type& valor, Crear& crear, Nodo* subraiz, const_iterator* posicion){
+    int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valor, comparar);
+    if (posicion != nullptr) posicion->Apilar(subraiz, i);
+
+    if (i < subraiz->elemNodo && !comparar(valor, subraiz->claves[i])) return false;
 
     if (EsHoja(subraiz)) {
         // Inserción en hoja
-        while (i >= 0 && valor < subraiz->claves[i]) {
-            subraiz->claves[i + 1] = subraiz->claves[i];
-            --i;
+        for (int j = subraiz->elemNodo; j > i; --j) {
+            Mover(subraiz, j, subraiz, j - 1);
         }
-        subraiz->claves[i + 1] = valor;
+        Poner(subraiz, i, crear());
         subraiz->elemNodo++;
         cantElem++;
-        ImprimirNiveles(); //Para pruebas
+        return true;
+    }
 
-        // Si la hoja se llena, hay que reequilibrar
-        if (subraiz->elemNodo == grado && subraiz == raiz) {
-            std::cout << "El nodo esta lleno" << std::endl;
-            OrdenarNodo(subraiz, i + 1);
-        }
-    } else {
-        // Elegir hijo adecuado
-        while (i >= 0 && valor < subraiz->claves[i]) --i;
-        ++i;
-        std::cout << "Bajando un nivel" << std::endl;
-        Agregar(valor, subraiz->hijo[i]);
+    Interno* interno = ComoInterno(subraiz);
+    Notificar(TipoEvento::Descenso, i);
+    Nodo* hijo = Propio(interno, i);
+    if (!Agregar(valor, crear, hijo, posicion)) return false;
+    Sumar(interno, i, 1);
 
-        // Tras bajar, si ese hijo se llenó, reequilibrar
-        if (subraiz->hijo[i]->elemNodo == grado) {
-            std::cout << "Se lleno el nodo visitado" << std::endl;
-            OrdenarNodo(subraiz, i);
+    // Tras bajar, si ese hijo se llenó, reequilibrar
+    if (interno->hijo[i]->elemNodo == grado) {
+        OrdenarNodo(interno, i);
+        if (posicion != nullptr) posicion->profundidad = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Inserta en el subárbol un tramo ordenado y sin repetidos del lote.
+ *
+ * Se detiene en cuanto subraiz queda desbordado (grado claves) para que quien llama lo
+ * reorganice y vuelva a repartir lo que falta; los valores consumidos siempre son un prefijo.
+ *
+ * @param valores Tramo del lote; los valores insertados se mueven a las hojas.
+ * @param n Cantidad de valores del tramo.
+ * @param subraiz Nodo raíz del subárbol (con menos de grado claves).
+ * @return Cantidad de valores consumidos (insertados o ya existentes), al menos uno.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::AgregarLote(Type* valores, int n, Nodo* subraiz) {
+    if (EsHoja(subraiz)) {
+        int m = subraiz->elemNodo;
+
+        // Tomar valores hasta desbordar la hoja una vez, saltando los que ya están
+        int consumidos = 0;
+        int nuevos = 0;
+        for (int j = 0; consumidos < n && m + nuevos < grado; ++consumidos) {
+            while (j < m && comparar(subraiz->claves[j], valores[consumidos])) ++j;
+            if (j == m || comparar(valores[consumidos], subraiz->claves[j])) ++nuevos;
         }
 
-        if(subraiz == raiz && subraiz->elemNodo == grado){
-            for(int i = 0 ; i < grado ; ++i){
-                OrdenarNodo(raiz, i);
+        // Mezclar desde el final para mover cada clave de la hoja una sola vez; cuando ya
+        // no quedan nuevos (escribir == leer), el resto de la hoja está en su lugar
+        int escribir = m + nuevos - 1;
+        int leer = m - 1;
+        for (int k = consumidos - 1; k >= 0 && escribir > leer; --k) {
+            while (leer >= 0 && comparar(valores[k], subraiz->claves[leer])) {
+                Mover(subraiz, escribir--, subraiz, leer);
+                --leer;
             }
+            if (leer >= 0 && !comparar(subraiz->claves[leer], valores[k])) continue; // ya existía
+            if constexpr (conCarga) subraiz->cargas[escribir] = Carga();
+            subraiz->claves[escribir--] = std::move(valores[k]);
         }
+        subraiz->elemNodo = m + nuevos;
+        cantElem += nuevos;
+        return consumidos;
     }
+
+    Interno* interno = ComoInterno(subraiz);
+    int hecho = 0;
+    while (hecho < n && subraiz->elemNodo < grado) {
+        int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valores[hecho], comparar);
+        if (i < subraiz->elemNodo && !comparar(valores[hecho], subraiz->claves[i])) {
+            ++hecho; // ya existía como separadora
+            continue;
+        }
+
+        // Bajan por hijo[i] los valores menores que la separadora de su derecha
+        int tramo = n - hecho;
+        if (i < subraiz->elemNodo) {
+            tramo = std::lower_bound(valores + hecho, valores + n, subraiz->claves[i], comparar) - (valores + hecho);
+        }
+
+        Notificar(TipoEvento::Descenso, i);
+        int antes = cantElem;
+        hecho += AgregarLote(valores + hecho, tramo, Propio(interno, i));
+        Sumar(interno, i, cantElem - antes);
+
+        // El hijo se desbordó: reorganizarlo y volver a repartir el resto con las nuevas separadoras
+        if (interno->hijo[i]->elemNodo == grado) {
+            OrdenarNodo(interno, i);
+        }
+    }
+    return hecho;
 }
 
 /**
- * @brief Reorganiza o divide un nodo que ha alcanzado su capacidad máxima.
+ * @brief Reorganiza o divide un hijo que ha alcanzado su capacidad máxima.
+ *
+ * Según la política de desborde, primero intenta redistribuir con los hermanos; si no
+ * hay lugar, divide el hijo en dos o, junto con un hermano adyacente, en tres. El padre
+ * puede quedar lleno, en cuyo caso lo resuelve su propio padre al regresar.
+ *
  * @param subraiz Nodo padre del hijo lleno.
- * @param indiceHijoHijo Índice del hijo que está lleno.
- */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::OrdenarNodo(Nodo* subraiz, int indiceHijoHijo) {
-    // Caso raíz llena y es hoja
-    if (subraiz == raiz && EsHoja(subraiz) && subraiz->elemNodo == grado) {
-        std::cout << "Dividiendo el nodo raíz (hoja)" << std::endl;
-        int minClaves = std::ceil((2.0 * grado) / 3.0) - 1;
-        int total = subraiz->elemNodo;
-        int clavesI = minClaves;
-        int clavesD = total - clavesI - 1;
-
-        Nodo* izquierdo = new Nodo();
-        Nodo* derecho = new Nodo();
-
-        // Copiar claves a izquierdo
-        for (int i = 0; i < clavesI; ++i) {
-            izquierdo->claves[i] = subraiz->claves[i];
-            izquierdo->elemNodo++;
-        }
-        // Copiar claves a derecho
-        for (int i = 0; i < clavesD; ++i) {
-            derecho->claves[i] = subraiz->claves[clavesI + 1 + i];
-            derecho->elemNodo++;
-        }
-
-        Type mid = subraiz->claves[clavesI];
-        Nodo* nueva = new Nodo();
-        nueva->claves[0] = mid;
-        nueva->elemNodo = 1;
-        nueva->hijo[0] = izquierdo;
-        nueva->hijo[1] = derecho;
-
-        delete subraiz;
-        raiz = nueva; 
-        return;
+ * @param indiceHijo Índice del hijo que está lleno.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::OrdenarNodo(Interno* subraiz, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(
+        indiceHijo, subraiz->elemNodo, grado, [subraiz](int i) { return subraiz->hijo[i]->elemNodo; });
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada: Redistribuir(subraiz, indiceHijo, plan.indice); break;
+        case Reorganizacion::Accion::Nivelar: RedistribuirVecino(subraiz, indiceHijo, plan.indice); break;
+        case Reorganizacion::Accion::DividirTriple: DividirTriple(subraiz, indiceHijo, plan.indice); break;
+        default: DividirDoble(subraiz, indiceHijo); break;
     }
+}
 
-    // raíz llena y NO es hoja ***
-    if (subraiz == raiz && !EsHoja(subraiz) && subraiz->elemNodo ==  grado) {
-        std::cout << "Dividiendo el nodo raíz (no hoja)" << std::endl;
+/**
+ * @brief Pasa la mitad derecha de un nodo lleno a un nodo nuevo.
+ *
+ * El original conserva las grado / 2 claves menores; la clave del medio, que debe subir
+ * al padre como separadora, queda en nodo->claves[nodo->elemNodo].
+ *
+ * @param nodo Nodo con grado claves.
+ * @return El nodo nuevo con las claves mayores que la separadora.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nodo* StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::PartirMitad(Nodo* nodo) {
+    bool hoja = nodo->hoja;
+    Nodo* derecho = CrearNodo(hoja);
 
-        // Triple división de la raíz
-        Nodo* izquierdo = new Nodo();
-        Nodo* derecho = new Nodo();
-        Nodo* nuevo = new Nodo();
+    int clavesI = Reorganizacion::Mitad(grado);
+    int clavesD = grado - clavesI - 1;
 
-        int total = subraiz->elemNodo;
-        int tercio = total / 3;
+    for (int i = 0; i < clavesD; ++i) {
+        Mover(derecho, i, nodo, clavesI + 1 + i);
+    }
+    if (!hoja) {
+        Interno* iz = ComoInterno(nodo);
+        Interno* de = ComoInterno(derecho);
+        for (int i = 0; i <= clavesD; ++i) {
+            de->hijo[i] = iz->hijo[clavesI + 1 + i];
+            iz->hijo[clavesI + 1 + i] = nullptr;
+            if constexpr (conteos) de->conteo[i] = iz->conteo[clavesI + 1 + i];
+        }
+    }
+    derecho->elemNodo = clavesD;
+    nodo->elemNodo = clavesI;
+    return derecho;
+}
+
+/**
+ * @brief Divide la raíz llena en dos nodos bajo una nueva raíz.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::DividirRaiz() {
+    Notificar(TipoEvento::DivisionRaiz, -1);
+
+    Nodo* izquierdo = raiz;
+    Nodo* derecho = PartirMitad(izquierdo);
+    Contar(&ContadoresArbol::clavesMovidas, derecho->elemNodo + 1);
+    Contar(&ContadoresArbol::nodosTocados, 3);
+
+    Interno* nueva = ComoInterno(CrearNodo(false));
+    Mover(nueva, 0, izquierdo, izquierdo->elemNodo);
+    nueva->elemNodo = 1;
+    nueva->hijo[0] = izquierdo;
+    nueva->hijo[1] = derecho;
+    Recontar(nueva, 0, 1);
+    raiz = nueva;
+}
+
+/**
+ * @brief Redistribuye un hijo lleno desplazando una clave en cascada hasta un hermano.
+ *
+ * La clave atraviesa los hermanos intermedios, cada uno cediendo su extremo al
+ * siguiente a través del padre.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo que está lleno.
+ * @param hermano Hermano con lugar más cercano (ver Reorganizacion::Desbordar).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Redistribuir(Interno* padre, int indiceHijo, int hermano) {
+    if (hermano < indiceHijo) {
+        Notificar(TipoEvento::RedistribucionIzquierda, indiceHijo, hermano);
+        Propios(padre, hermano, indiceHijo);
+        for (int j = hermano; j < indiceHijo; ++j) {
+            // Dos claves cambian de nodo y el resto del derecho se corre un lugar
+            Contar(&ContadoresArbol::clavesMovidas, padre->hijo[j + 1]->elemNodo + 1);
+            RotarIzquierda(padre, j);
+        }
+        Contar(&ContadoresArbol::nodosTocados, indiceHijo - hermano + 2);
+    } else {
+        Notificar(TipoEvento::RedistribucionDerecha, indiceHijo, hermano);
+        Propios(padre, indiceHijo, hermano);
+        for (int j = hermano; j > indiceHijo; --j) {
+            Contar(&ContadoresArbol::clavesMovidas, padre->hijo[j]->elemNodo + 2);
+            RotarDerecha(padre, j - 1);
+        }
+        Contar(&ContadoresArbol::nodosTocados, hermano - indiceHijo + 2);
+    }
+}
 
-        // Copiar claves e hijos al izquierdo
-        for (int i = 0; i < tercio; ++i) {
-            izquierdo->claves[i] = subraiz->claves[i];
-            izquierdo->hijo[i] = subraiz->hijo[i];
-            izquierdo->elemNodo++;
+/**
+ * @brief Reparte un hijo lleno con un hermano adyacente que tenga lugar.
+ *
+ * A diferencia de Redistribuir, no pasa por los hermanos intermedios y deja ambos nodos
+ * con la misma cantidad de claves en un único movimiento, de modo que el siguiente
+ * desborde de ese par tarda lo más posible.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo que está lleno.
+ * @param indice Separadora entre el hijo y el vecino (indiceHijo - 1 o indiceHijo).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RedistribuirVecino(Interno* padre, int indiceHijo, int indice) {
+    if (indice < indiceHijo) {
+        Notificar(TipoEvento::RedistribucionIzquierda, indiceHijo, indice);
+    } else {
+        Notificar(TipoEvento::RedistribucionDerecha, indiceHijo, indice + 1);
+    }
+
+    Propios(padre, indice, indice + 1);
+    Contar(&ContadoresArbol::clavesMovidas, Nivelar(padre, indice));
+    Contar(&ContadoresArbol::nodosTocados, 3);
+}
+
+/**
+ * @brief Deja hijo[indice] e hijo[indice + 1] con la misma cantidad de claves (±1).
+ *
+ * Equivale a varias rotaciones seguidas, pero cada clave se mueve una sola vez: las que
+ * cruzan pasan por la separadora del padre y las que quedan se corren de una vez.
+ *
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ * @return Cantidad de claves escritas en otro lugar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Nivelar(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+    bool hoja = EsHoja(izquierdo);
+    int n = izquierdo->elemNodo;
+    int m = derecho->elemNodo;
+    int k = Reorganizacion::Mitad(n + m) - n; // Claves que ganará el izquierdo (negativo: que cederá)
+    int movidas = 0;
+
+    if (k > 0) {
+        // La separadora y k - 1 claves del derecho al izquierdo; la k-ésima sube al padre
+        Mover(izquierdo, n, padre, indice);
+        for (int j = 0; j < k - 1; ++j) {
+            Mover(izquierdo, n + 1 + j, derecho, j);
+        }
+        Mover(padre, indice, derecho, k - 1);
+        for (int j = k; j < m; ++j) {
+            Mover(derecho, j - k, derecho, j);
+        }
+        if (!hoja) {
+            Interno* iz = ComoInterno(izquierdo);
+            Interno* de = ComoInterno(derecho);
+            for (int j = 0; j < k; ++j) {
+                iz->hijo[n + 1 + j] = de->hijo[j];
+                if constexpr (conteos) iz->conteo[n + 1 + j] = de->conteo[j];
+            }
+            for (int j = k; j <= m; ++j) {
+                de->hijo[j - k] = de->hijo[j];
+                if constexpr (conteos) de->conteo[j - k] = de->conteo[j];
+            }
+            for (int j = m - k + 1; j <= m; ++j) de->hijo[j] = nullptr;
+        }
+        movidas = m + 1;
+    } else if (k < 0) {
+        k = -k;
+        // Abrir k lugares al principio del derecho
+        for (int j = m - 1; j >= 0; --j) {
+            Mover(derecho, j + k, derecho, j);
+        }
+        Mover(derecho, k - 1, padre, indice);
+        for (int j = 0; j < k - 1; ++j) {
+            Mover(derecho, j, izquierdo, n - k + 1 + j);
+        }
+        Mover(padre, indice, izquierdo, n - k);
+        if (!hoja) {
+            Interno* iz = ComoInterno(izquierdo);
+            Interno* de = ComoInterno(derecho);
+            for (int j = m; j >= 0; --j) {
+                de->hijo[j + k] = de->hijo[j];
+                if constexpr (conteos) de->conteo[j + k] = de->conteo[j];
+            }
+            for (int j = 0; j < k; ++j) {
+                de->hijo[j] = iz->hijo[n - k + 1 + j];
+                iz->hijo[n - k + 1 + j] = nullptr;
+                if constexpr (conteos) de->conteo[j] = iz->conteo[n - k + 1 + j];
+            }
         }
-        izquierdo->hijo[tercio] = subraiz->hijo[tercio];
+        movidas = m + k + 1;
+    }
+
+    izquierdo->elemNodo = Reorganizacion::Mitad(n + m);
+    derecho->elemNodo = n + m - izquierdo->elemNodo;
+    Recontar(padre, indice, indice + 1);
+    return movidas;
+}
 
-        // Copiar claves e hijos al derecho
-        for (int i = 0; i < tercio; ++i) {
-            derecho->claves[i] = subraiz->claves[tercio * 2 + 1 + i];
-            derecho->hijo[i] = subraiz->hijo[tercio * 2 + 1 + i];
-            derecho->elemNodo++;
+/**
+ * @brief Pasa la primera clave de hijo[indice + 1] a hijo[indice] a través del padre.
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RotarIzquierda(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+    bool hoja = EsHoja(derecho);
+    int movidos = 1; // La clave y el subárbol que la acompaña
+
+    // Mover la clave del padre hacia el final del izquierdo
+    Mover(izquierdo, izquierdo->elemNodo, padre, indice);
+    if (!hoja) {
+        ComoInterno(izquierdo)->hijo[izquierdo->elemNodo + 1] = ComoInterno(derecho)->hijo[0];
+        if constexpr (conteos) {
+            movidos += ComoInterno(derecho)->conteo[0];
+            ComoInterno(izquierdo)->conteo[izquierdo->elemNodo + 1] = ComoInterno(derecho)->conteo[0];
         }
-        derecho->hijo[tercio] = subraiz->hijo[total];
+    }
+    izquierdo->elemNodo++;
 
-        // Clave del medio
-        Type mid1 = subraiz->claves[tercio];
-        Type mid2 = subraiz->claves[tercio * 2 + 1];
+    // Subir la primera clave del derecho al padre
+    Mover(padre, indice, derecho, 0);
 
-        nuevo->claves[0] = mid1;
-        nuevo->claves[1] = mid2;
-        nuevo->elemNodo = 2;
+    // Desplazar a la izquierda todas las claves e hijos del derecho
+    for (int j = 0; j < derecho->elemNodo - 1; ++j) {
+        Mover(derecho, j, derecho, j + 1);
+    }
+    if (!hoja) {
+        Interno* d = ComoInterno(derecho);
+        for (int j = 0; j < derecho->elemNodo; ++j) {
+            d->hijo[j] = d->hijo[j + 1];
+            if constexpr (conteos) d->conteo[j] = d->conteo[j + 1];
+        }
+        d->hijo[derecho->elemNodo] = nullptr;
+    }
+    derecho->elemNodo--;
+    Sumar(padre, indice, movidos);
+    Sumar(padre, indice + 1, -movidos);
+}
 
-        // Nodo central
-        Nodo* centro = new Nodo();
-        for (int i = 0; i < tercio; ++i) {
-            centro->claves[i] = subraiz->claves[tercio + 1 + i];
-            centro->hijo[i] = subraiz->hijo[tercio + 1 + i];
-            centro->elemNodo++;
+/**
+ * @brief Pasa la última clave de hijo[indice] a hijo[indice + 1] a través del padre.
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RotarDerecha(Interno* padre, int indice) {
+    Nodo* izquierdo = padre->hijo[indice];
+    Nodo* derecho = padre->hijo[indice + 1];
+    bool hoja = EsHoja(izquierdo);
+    int movidos = 1; // La clave y el subárbol que la acompaña
+
+    // Desplazar claves e hijos del derecho a la derecha
+    for (int j = derecho->elemNodo; j > 0; --j) {
+        Mover(derecho, j, derecho, j - 1);
+    }
+    if (!hoja) {
+        Interno* d = ComoInterno(derecho);
+        for (int j = derecho->elemNodo + 1; j > 0; --j) {
+            d->hijo[j] = d->hijo[j - 1];
+            if constexpr (conteos) d->conteo[j] = d->conteo[j - 1];
         }
-        centro->hijo[tercio] = subraiz->hijo[tercio * 2 + 1];
+    }
 
-        // Conectar nuevos hijos
-        nuevo->hijo[0] = izquierdo;
-        nuevo->hijo[1] = centro;
-        nuevo->hijo[2] = derecho;
+    // Mover clave del padre a derecho[0]
+    Mover(derecho, 0, padre, indice);
+    if (!hoja) {
+        Interno* iz = ComoInterno(izquierdo);
+        ComoInterno(derecho)->hijo[0] = iz->hijo[izquierdo->elemNodo];
+        iz->hijo[izquierdo->elemNodo] = nullptr;
+        if constexpr (conteos) {
+            movidos += iz->conteo[izquierdo->elemNodo];
+            ComoInterno(derecho)->conteo[0] = iz->conteo[izquierdo->elemNodo];
+        }
+    }
+    derecho->elemNodo++;
 
-        delete subraiz;
-        raiz = nuevo;
-        return;
+    // Subir la última clave del izquierdo al padre
+    Mover(padre, indice, izquierdo, izquierdo->elemNodo - 1);
+    izquierdo->elemNodo--;
+    Sumar(padre, indice, -movidos);
+    Sumar(padre, indice + 1, movidos);
+}
+
+/**
+ * @brief Realiza una división triple de un hijo lleno y un hermano adyacente.
+ *
+ * Las claves de ambos nodos más la separadora se reparten en tres nodos con
+ * dos separadoras; el padre gana una clave y un hijo.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo lleno.
+ * @param posFusion Separadora entre el hijo y el hermano elegido (ver Reorganizacion::Desbordar).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::DividirTriple(Interno* padre, int indiceHijo, int posFusion) {
+    Notificar(TipoEvento::DivisionTriple, indiceHijo, (posFusion < indiceHijo) ? posFusion : posFusion + 1);
+
+    Nodo* A = Propio(padre, posFusion);
+    Nodo* C = Propio(padre, posFusion + 1);
+    bool hoja = EsHoja(A);
+    Nodo* B = CrearNodo(hoja);
+
+    std::vector<Entrada> fusion;
+    std::vector<Nodo*> fusionHijos;
+
+    fusion.reserve(A->elemNodo + C->elemNodo + 1);
+    for (int i = 0; i < A->elemNodo; ++i)
+        fusion.push_back(Tomar(A, i));
+    fusion.push_back(Tomar(padre, posFusion));
+    for (int i = 0; i < C->elemNodo; ++i)
+        fusion.push_back(Tomar(C, i));
+
+    if (!hoja) {
+        for (int i = 0; i <= A->elemNodo; ++i)
+            fusionHijos.push_back(ComoInterno(A)->hijo[i]);
+        for (int i = 0; i <= C->elemNodo; ++i)
+            fusionHijos.push_back(ComoInterno(C)->hijo[i]);
     }
 
-    // Caso general: reequilibrar hijo
-    std::cout << "Intentando redistribuir" << std::endl;
-    Redistribuir(subraiz, indiceHijoHijo);
+    // Repartir las claves restantes (sin las dos separadoras) en tres tercios
+    int total = fusion.size();
+    Reorganizacion::Tercios tercios = Reorganizacion::Triple(total - 2);
+    int clavesA = tercios.a;
+    int clavesB = tercios.b;
+    int clavesC = tercios.c;
+
+    int idx = 0;
+    for (int i = 0; i < clavesA; ++i) Poner(A, i, std::move(fusion[idx++]));
+    Entrada sepAB = std::move(fusion[idx++]);
+    for (int i = 0; i < clavesB; ++i) Poner(B, i, std::move(fusion[idx++]));
+    Entrada sepBC = std::move(fusion[idx++]);
+    for (int i = 0; i < clavesC; ++i) Poner(C, i, std::move(fusion[idx++]));
+
+    A->elemNodo = clavesA;
+    B->elemNodo = clavesB;
+    C->elemNodo = clavesC;
 
-    // Si sigue lleno, dividir
-    if (subraiz->hijo[indiceHijoHijo]->elemNodo == grado) {
-        std::cout << "Triple división (no es raíz)" << std::endl;
-        DividirTriple(subraiz, indiceHijoHijo);
+    // Si no son hojas, distribuir hijos
+    if (!hoja) {
+        Interno* iA = ComoInterno(A);
+        Interno* iB = ComoInterno(B);
+        Interno* iC = ComoInterno(C);
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            iA->hijo[i] = (i <= clavesA) ? fusionHijos[idx++] : nullptr;
+        for (int i = 0; i <= clavesB; ++i)
+            iB->hijo[i] = fusionHijos[idx++];
+        for (int i = 0; i <= grado; ++i)
+            iC->hijo[i] = (i <= clavesC) ? fusionHijos[idx++] : nullptr;
+        Recontar(iA, 0, clavesA);
+        Recontar(iB, 0, clavesB);
+        Recontar(iC, 0, clavesC);
+    }
+
+    // Desplazar claves y punteros en padre para abrir lugar a B
+    for (int i = padre->elemNodo; i > posFusion + 1; --i) {
+        Mover(padre, i, padre, i - 1);
+        padre->hijo[i + 1] = padre->hijo[i];
+        if constexpr (conteos) padre->conteo[i + 1] = padre->conteo[i];
     }
+    Contar(&ContadoresArbol::clavesMovidas, total + (padre->elemNodo - posFusion - 1));
+    Contar(&ContadoresArbol::nodosTocados, 4);
+    padre->elemNodo++;
+
+    Poner(padre, posFusion, std::move(sepAB));
+    Poner(padre, posFusion + 1, std::move(sepBC));
+    padre->hijo[posFusion + 1] = B;
+    padre->hijo[posFusion + 2] = C;
+    Recontar(padre, posFusion, posFusion + 2);
 }
 
+/**
+ * @brief Divide un hijo lleno en dos, como un Árbol B clásico.
+ *
+ * El hijo conserva la mitad izquierda, un nodo nuevo recibe la derecha y la clave del
+ * medio sube al padre, que gana una clave y un hijo. No mira a los hermanos.
+ *
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo lleno.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::DividirDoble(Interno* padre, int indiceHijo) {
+    Notificar(TipoEvento::DivisionDoble, indiceHijo);
 
-/*template <typename Type, int grado>
-void StarBTree<Type, grado>::OrdenarNodo(Nodo* subraiz, int indiceHijoHijo) {
-    // caso raíz hoja
-    if (subraiz == raiz && EsHoja(subraiz) && subraiz->elemNodo == grado) {
-        std::cout << "Dividiendo el nodo raiz" << std::endl;
-        int minClaves = std::ceil((2.0 * grado) / 3.0) - 1;
-        int total = subraiz->elemNodo;
-        int clavesI = minClaves;
-        int clavesD = total - clavesI - 1;
+    Nodo* izquierdo = Propio(padre, indiceHijo);
+    Nodo* derecho = PartirMitad(izquierdo);
 
-        Nodo* izquierdo = new Nodo();
-        Nodo* derecho = new Nodo();
+    // Abrir lugar en el padre para la separadora y el nuevo hijo
+    for (int i = padre->elemNodo; i > indiceHijo; --i) {
+        Mover(padre, i, padre, i - 1);
+        padre->hijo[i + 1] = padre->hijo[i];
+        if constexpr (conteos) padre->conteo[i + 1] = padre->conteo[i];
+    }
+    Contar(&ContadoresArbol::clavesMovidas, derecho->elemNodo + 1 + (padre->elemNodo - indiceHijo));
+    Contar(&ContadoresArbol::nodosTocados, 3);
+    padre->elemNodo++;
 
-        // L
-        for (int i = 0; i < clavesI; ++i) {
-            izquierdo->claves[i] = subraiz->claves[i];
-            izquierdo->elemNodo++;
-        }
-        // R
-        for (int i = 0; i < clavesD; ++i) {
-            derecho->claves[i] = subraiz->claves[clavesI + 1 + i];
-            derecho->elemNodo++;
-        }
-        // Nueva raíz
-        Type mid = subraiz->claves[clavesI];
-        Nodo* nueva = new Nodo();
-        nueva->claves[0] = mid;
-        nueva->elemNodo = 1;
-        nueva->hijo[0] = izquierdo;
-        nueva->hijo[1] = derecho;
+    Mover(padre, indiceHijo, izquierdo, izquierdo->elemNodo);
+    padre->hijo[indiceHijo + 1] = derecho;
+    Recontar(padre, indiceHijo, indiceHijo + 1);
+}
 
-        delete subraiz;
-        raiz = nueva; 
-        return;
+/**
+ * @brief Elimina un valor del árbol.
+ * @param valor Valor a eliminar.
+ * @return true si el valor existía y se eliminó, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Eliminar(const Type& valor) {
+    if (raiz == nullptr) return false;
+    if (Compartido(raiz)) raiz = Duplicar(raiz);
+
+    if (!Eliminar(valor, raiz)) return false;
+
+    // Si la raíz quedó sin claves, el árbol pierde un nivel
+    if (raiz->elemNodo == 0) {
+        Nodo* vieja = raiz;
+        raiz = EsHoja(vieja) ? nullptr : ComoInterno(vieja)->hijo[0];
+        Destruir(vieja);
+        Notificar(TipoEvento::ContraccionRaiz, -1);
     }
+    return true;
+}
+
+/**
+ * @brief Elimina recursivamente un valor del subárbol dado.
+ *
+ * Una clave de un nodo interno se reemplaza por su predecesor, que se elimina de
+ * la hoja correspondiente. Al regresar, si el hijo visitado quedó por debajo del
+ * mínimo, se corrige con préstamos o fusiones.
+ *
+ * @param valor Valor a eliminar.
+ * @param subraiz Nodo raíz del subárbol.
+ * @return true si el valor se eliminó, false si no existía.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Eliminar(const Type& valor, Nodo* subraiz) {
+    int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valor, comparar);
+    bool encontrado = i < subraiz->elemNodo && !comparar(valor, subraiz->claves[i]);
 
-    // caso general: reequilibrar al hijo indiceHijoHijo
-    /*Nodo* h = subraiz->hijo[indiceHijoHijo];
-    if (h->elemNodo < grado) return;  // nada que hacer*/
+    if (EsHoja(subraiz)) {
+        if (!encontrado) return false;
 
-    // 1) intentar redistribuir
-    /*std::cout << "Redistribuyendo" << std::endl;
-    Redistribuir(subraiz, indiceHijoHijo);
+        for (int j = i; j < subraiz->elemNodo - 1; ++j) {
+            Mover(subraiz, j, subraiz, j + 1);
+        }
+        subraiz->elemNodo--;
+        cantElem--;
+        return true;
+    }
 
-    // 2) si sigue lleno, dividir
-    if (subraiz->hijo[indiceHijoHijo]->elemNodo == grado) {
-        std::cout << "Triple division" << std::endl;
-        DividirTriple(subraiz, indiceHijoHijo);
+    Interno* interno = ComoInterno(subraiz);
+    if (encontrado) {
+        // Reemplazar por el predecesor (máximo del subárbol izquierdo)
+        Nodo* pred = interno->hijo[i];
+        while (!EsHoja(pred)) pred = ComoInterno(pred)->hijo[pred->elemNodo];
+        subraiz->claves[i] = pred->claves[pred->elemNodo - 1];
+        // La carga puede moverse: sin instantáneas la hoja del predecesor es privada
+        if constexpr (conCarga) subraiz->cargas[i] = std::move(pred->cargas[pred->elemNodo - 1]);
+        Eliminar(subraiz->claves[i], Propio(interno, i));
+    } else if (!Eliminar(valor, Propio(interno, i))) {
+        return false;
     }
-}*/
+    Sumar(interno, i, -1);
+
+    if (interno->hijo[i]->elemNodo < Reorganizacion::MinClaves(grado)) {
+        CorregirSubflujo(interno, i);
+    }
+    return true;
+}
 
 /**
- * @brief Intenta redistribuir claves entre hermanos antes de dividir.
+ * @brief Corrige un hijo que quedó con menos claves que el mínimo.
+ *
+ * Primero pide prestada una clave al hermano más cercano que tenga claves de sobra,
+ * desplazándola en cascada como en Redistribuir. Si ningún hermano puede prestar,
+ * fusiona tres hermanos en dos; si el padre solo tiene dos hijos, los fusiona en uno
+ * cuando caben.
+ *
  * @param padre Nodo padre.
- * @param indiceHijo Índice del hijo que está lleno.
+ * @param indiceHijo Índice del hijo con subflujo.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::Redistribuir(Nodo* padre, int indiceHijo) {
-    std::cout << "Redistribucion" << std::endl;
-    Nodo* h = padre->hijo[indiceHijo];
-    bool hijoHoja = EsHoja(h);
-
-    if(h->elemNodo < grado){
-        std::cout << "Advertencia: Se intento redistribuir un nodo que aùn no se llena" << std::endl;
-    } 
-
-    // INTENTAR REDISTRIBUIR EN CASCADA A LA IZQUIERDA
-    for (int i = indiceHijo - 1; i >= 0; --i) {
-        Nodo* izquierdo = padre->hijo[i];
-        if (izquierdo->elemNodo < grado) {
-            std::cout << "Redistribuyendo en cascada hacia la izquierda con el hijo[" << i << "]\n";
-
-            // Mover la clave del padre hacia el final del izquierdo
-            izquierdo->claves[izquierdo->elemNodo] = padre->claves[i];
-
-            if (!hijoHoja)
-                izquierdo->hijo[izquierdo->elemNodo + 1] = padre->hijo[i + 1]->hijo[0];
-            izquierdo->elemNodo++;
-
-            // Subir la primera clave del nodo h actual al padre
-            padre->claves[i] = h->claves[0];
-
-            // Desplazar a la izquierda todas las claves e hijos en h
-            for (int j = 0; j < h->elemNodo - 1; ++j) {
-                h->claves[j] = h->claves[j + 1];
-                if (!hijoHoja)
-                    h->hijo[j] = h->hijo[j + 1];
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::CorregirSubflujo(Interno* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Subflujo(
+        indiceHijo, padre->elemNodo, grado, [padre](int i) { return padre->hijo[i]->elemNodo; });
+    int i = plan.indice;
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada:
+            if (i < indiceHijo) {
+                // Préstamo en cascada desde la izquierda
+                Notificar(TipoEvento::RedistribucionDerecha, i, indiceHijo);
+                Propios(padre, i, indiceHijo);
+                for (int j = i; j < indiceHijo; ++j) {
+                    RotarDerecha(padre, j);
+                }
+            } else {
+                // Préstamo en cascada desde la derecha
+                Notificar(TipoEvento::RedistribucionIzquierda, i, indiceHijo);
+                Propios(padre, indiceHijo, i);
+                for (int j = i - 1; j >= indiceHijo; --j) {
+                    RotarIzquierda(padre, j);
+                }
             }
-            if (!hijoHoja)
-                h->hijo[h->elemNodo - 1] = h->hijo[h->elemNodo];
-            h->elemNodo--;
+            break;
+        case Reorganizacion::Accion::FusionarTriple: FusionarTriple(padre, i); break;
+        case Reorganizacion::Accion::FusionarDoble: FusionarDoble(padre); break;
+        default: break;
+    }
+}
 
-            return;
+/**
+ * @brief Fusiona tres hermanos consecutivos en dos.
+ *
+ * Las claves de los tres nodos y las dos separadoras se reparten en dos nodos con
+ * una separadora; el padre pierde una clave y un hijo.
+ *
+ * @param padre Nodo padre.
+ * @param inicio Índice del primero de los tres hermanos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::FusionarTriple(Interno* padre, int inicio) {
+    Notificar(TipoEvento::Fusion, inicio, inicio + 2);
+    Propios(padre, inicio, inicio + 2);
+
+    Nodo* A = padre->hijo[inicio];
+    Nodo* B = padre->hijo[inicio + 1];
+    Nodo* C = padre->hijo[inicio + 2];
+    bool hoja = EsHoja(A);
+
+    std::vector<Entrada> fusion;
+    std::vector<Nodo*> fusionHijos;
+
+    Nodo* nodos[3] = {A, B, C};
+    for (int k = 0; k < 3; ++k) {
+        for (int i = 0; i < nodos[k]->elemNodo; ++i)
+            fusion.push_back(Tomar(nodos[k], i));
+        if (k < 2)
+            fusion.push_back(Tomar(padre, inicio + k));
+        if (!hoja) {
+            for (int i = 0; i <= nodos[k]->elemNodo; ++i)
+                fusionHijos.push_back(ComoInterno(nodos[k])->hijo[i]);
         }
     }
 
-    // SI NO SE PUDO A LA IZQUIERDA, INTENTAR REDISTRIBUIR A LA DERECHA
-    for (int i = indiceHijo + 1; i <= padre->elemNodo; ++i) {
-        Nodo* derecho = padre->hijo[i];
-        if (derecho->elemNodo < grado) {
-            std::cout << "Redistribuyendo hacia la derecha con el hijo[" << i << "]\n";
+    // Repartir en dos mitades con una separadora
+    int total = fusion.size();
+    int clavesA = Reorganizacion::Mitad(total - 1);
+    int clavesB = total - 1 - clavesA;
+
+    int idx = 0;
+    for (int i = 0; i < clavesA; ++i) Poner(A, i, std::move(fusion[idx++]));
+    Poner(padre, inicio, std::move(fusion[idx++]));
+    for (int i = 0; i < clavesB; ++i) Poner(B, i, std::move(fusion[idx++]));
+
+    A->elemNodo = clavesA;
+    B->elemNodo = clavesB;
+
+    if (!hoja) {
+        Interno* iA = ComoInterno(A);
+        Interno* iB = ComoInterno(B);
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            iA->hijo[i] = (i <= clavesA) ? fusionHijos[idx++] : nullptr;
+        for (int i = 0; i <= grado; ++i)
+            iB->hijo[i] = (i <= clavesB) ? fusionHijos[idx++] : nullptr;
+        Recontar(iA, 0, clavesA);
+        Recontar(iB, 0, clavesB);
+    }
 
-            // Desplazar claves e hijos del derecho a la derecha
-            for (int j = derecho->elemNodo; j > 0; --j) {
-                derecho->claves[j] = derecho->claves[j - 1];
-                if (!hijoHoja)
-                    derecho->hijo[j + 1] = derecho->hijo[j];
-            }
-            if (!hijoHoja)
-                derecho->hijo[1] = derecho->hijo[0];
+    // Quitar la segunda separadora y el tercer hijo del padre
+    for (int i = inicio + 1; i < padre->elemNodo - 1; ++i) {
+        Mover(padre, i, padre, i + 1);
+        padre->hijo[i + 1] = padre->hijo[i + 2];
+        if constexpr (conteos) padre->conteo[i + 1] = padre->conteo[i + 2];
+    }
+    padre->hijo[padre->elemNodo] = nullptr;
+    padre->elemNodo--;
+    Recontar(padre, inicio, inicio + 1);
+
+    Destruir(C);
+}
+
+/**
+ * @brief Fusiona los dos únicos hijos de un nodo en uno solo.
+ *
+ * El padre queda sin claves; solo ocurre bajo la raíz, que luego se contrae.
+ *
+ * @param padre Nodo padre con exactamente dos hijos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::FusionarDoble(Interno* padre) {
+    Notificar(TipoEvento::Fusion, 0, 1);
+    Propios(padre, 0, 1);
+
+    Nodo* A = padre->hijo[0];
+    Nodo* B = padre->hijo[1];
+    bool hoja = EsHoja(A);
+
+    Mover(A, A->elemNodo, padre, 0);
+    for (int i = 0; i < B->elemNodo; ++i) {
+        Mover(A, A->elemNodo + 1 + i, B, i);
+    }
+    if (!hoja) {
+        for (int i = 0; i <= B->elemNodo; ++i) {
+            ComoInterno(A)->hijo[A->elemNodo + 1 + i] = ComoInterno(B)->hijo[i];
+            if constexpr (conteos) ComoInterno(A)->conteo[A->elemNodo + 1 + i] = ComoInterno(B)->conteo[i];
+        }
+    }
+    A->elemNodo += B->elemNodo + 1;
+
+    padre->hijo[1] = nullptr;
+    padre->elemNodo = 0;
+    Recontar(padre, 0, 0);
+
+    Destruir(B);
+}
+
+/**
+ * @brief Verifica si un nodo es hoja.
+ * 
+ * Consulta la marca guardada en el nodo, en O(1).
+ * 
+ * @tparam Type Tipo de dato almacenado en el árbol.
+ * @tparam grado Grado del árbol B*.
+ * @param nodo Nodo a verificar.
+ * @return true si es hoja, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::EsHoja(const Nodo* nodo) const {
+    return nodo->hoja;
+}
+
+/**
+ * @brief Mueve la clave origen[j] (y su carga, si el árbol las guarda) a destino[i].
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Mover(Nodo* destino, int i, Nodo* origen, int j) {
+    destino->claves[i] = std::move(origen->claves[j]);
+    if constexpr (conCarga) destino->cargas[i] = std::move(origen->cargas[j]);
+}
 
-            // Mover clave del padre a derecho[0]
-            derecho->claves[0] = padre->claves[i - 1];
-            if (!hijoHoja)
-                derecho->hijo[0] = h->hijo[h->elemNodo];
-            derecho->elemNodo++;
+/**
+ * @brief Saca la clave nodo[i] (con su carga) para un reparto a través de un arreglo temporal.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Entrada StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Tomar(Nodo* nodo, int i) {
+    if constexpr (conCarga) {
+        return Entrada{std::move(nodo->claves[i]), std::move(nodo->cargas[i])};
+    } else {
+        return std::move(nodo->claves[i]);
+    }
+}
 
-            // Subir la última clave de h al padre
-            padre->claves[i - 1] = h->claves[h->elemNodo - 1];
-            h->elemNodo--;
+/**
+ * @brief Escribe una clave (con su carga) en nodo[i].
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Poner(Nodo* nodo, int i, Entrada&& entrada) {
+    if constexpr (conCarga) {
+        nodo->claves[i] = std::move(entrada.clave);
+        nodo->cargas[i] = std::move(entrada.carga);
+    } else {
+        nodo->claves[i] = std::move(entrada);
+    }
+}
+
+/**
+ * @brief Clave de una entrada.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+const Type& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ClaveDe(const Entrada& entrada) {
+    if constexpr (conCarga) {
+        return entrada.clave;
+    } else {
+        return entrada;
+    }
+}
+
+/**
+ * @brief Busca un valor en el árbol.
+ * 
+ * @tparam Type Tipo de dato almacenado en el árbol.
+ * @tparam grado Grado del árbol B*.
+ * @param valor Valor a buscar.
+ * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Buscar(const Type& valor) const {
+    return Buscar(valor, raiz);
+}
+
+/**
+ * @brief Busca un valor de otro tipo comparable con las claves, sin construir un Type.
+ *
+ * Solo está disponible si Compare es transparente (define is_transparent), como std::less<>.
+ *
+ * @param valor Valor a buscar.
+ * @return true si hay una clave equivalente a valor, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename K, typename C, typename>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Buscar(const K& valor) const {
+    return Buscar(valor, raiz);
+}
+
+/**
+ * @brief Función auxiliar recursiva para buscar un valor.
+ * 
+ * @param valor Valor a buscar.
+ * @param subraiz Subárbol en el que se realiza la búsqueda.
+ * @return true si el valor se encuentra, false en caso contrario.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename K>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Buscar(const K& valor, const Nodo* subraiz) const {
+    if(subraiz == nullptr) return false;
+    
+    int i = Busqueda::Posicion(subraiz->claves, subraiz->elemNodo, valor, comparar);
+    
+    if(i < subraiz->elemNodo && !comparar(valor, subraiz->claves[i])) {
+        return true;
+    }
+    if(EsHoja(subraiz)) return false;
+    
+    return Buscar(valor, ComoInterno(subraiz)->hijo[i]);
+}
+
+/**
+ * @brief Busca muchas claves a la vez intercalando sus descensos.
+ *
+ * Las claves se procesan en grupos de grupoLote. Todas las hojas están a la misma
+ * profundidad, así que el grupo baja nivel por nivel: mientras se busca dentro del nodo
+ * de una clave, ya se pidió a memoria el nodo siguiente de las demás, y los fallos de
+ * caché de un nivel se solapan en lugar de esperarse uno tras otro.
+ *
+ * @param inicio Iterador de avance (se lee cada clave una vez por nivel).
+ * @param fin Iterador al final de las claves.
+ * @param resultados Iterador de salida que recibe un bool por clave, en el mismo orden.
+ * @return Cantidad de claves encontradas.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Iterador, typename Salida>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::BuscarLote(Iterador inicio, Iterador fin, Salida resultados) const {
+    int encontradas = 0;
+    if (raiz != nullptr) Precargar(raiz);
+
+    while (inicio != fin) {
+        Iterador clave[grupoLote];
+        const Nodo* nodo[grupoLote];
+        bool hallada[grupoLote];
+        int cantidad = 0;
+        for (; inicio != fin && cantidad < grupoLote; ++inicio, ++cantidad) {
+            clave[cantidad] = inicio;
+            nodo[cantidad] = raiz;
+            hallada[cantidad] = false;
+        }
+
+        int activas = (raiz != nullptr) ? cantidad : 0;
+        while (activas > 0) {
+            for (int k = 0; k < cantidad; ++k) {
+                const Nodo* actual = nodo[k];
+                if (actual == nullptr) continue;
+
+                int i = Busqueda::Posicion(actual->claves, actual->elemNodo, *clave[k], comparar);
+                if (i < actual->elemNodo && !comparar(*clave[k], actual->claves[i])) {
+                    hallada[k] = true;
+                } else if (!EsHoja(actual)) {
+                    nodo[k] = ComoInterno(actual)->hijo[i];
+                    Precargar(nodo[k]);
+                    continue;
+                }
+                nodo[k] = nullptr;
+                --activas;
+            }
+        }
 
-            return;
+        for (int k = 0; k < cantidad; ++k) {
+            encontradas += hallada[k];
+            *resultados++ = hallada[k];
         }
     }
+    return encontradas;
+}
 
-    // SI NO SE PUDO REDISTRIBUIR, HACER DIVISIÓN TRIPLE
-    std::cout << "No se pudo redistribuir, dividiendo triple" << std::endl;
-    DividirTriple(padre, indiceHijo);
-
-    if(padre == raiz && padre->elemNodo == grado){
-            for(int i = 0 ; i < grado ; ++i){
-                OrdenarNodo(raiz, i);
-            }
-        }
+/**
+ * @brief Pide a la caché las primeras líneas del nodo (contador y claves) sin esperarlas.
+ * @param nodo Nodo que se leerá pronto.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Precargar(const Nodo* nodo) {
+#if defined(__GNUC__)
+    // Basta con las líneas que recorre la búsqueda dentro del nodo, hasta ocho
+    constexpr std::size_t linea = 64;
+    constexpr std::size_t bytes = sizeof(Nodo) < 8 * linea ? sizeof(Nodo) : 8 * linea;
+    const char* p = reinterpret_cast<const char*>(nodo);
+    for (std::size_t desplazamiento = 0; desplazamiento < bytes; desplazamiento += linea) {
+        __builtin_prefetch(p + desplazamiento);
+    }
+#else
+    (void)nodo;
+#endif
 }
-/*template <typename Type, int grado>
-void StarBTree<Type, grado>::Redistribuir(Nodo* padre, int indiceH) {
-    std::cout << "Intentando redistribuir hijo[" << indiceH << "]\n";
 
-    Nodo* actual = padre->hijo[indiceH];
-    bool esHoja = EsHoja(actual);
+/**
+ * @brief Construye el árbol de abajo hacia arriba a partir de una secuencia ordenada.
+ *
+ * Reemplaza el contenido actual. Cada nivel se arma en un solo recorrido repartiendo
+ * las claves de forma pareja entre los nodos; las claves que quedan entre nodos
+ * consecutivos forman el nivel superior. El costo total es O(n).
+ *
+ * @param inicio Iterador al primer elemento (la secuencia debe estar en orden ascendente).
+ * @param fin Iterador al final de la secuencia.
+ * @param llenado Fracción objetivo de llenado de cada nodo, en [2/3, 1].
+ * @throws std::invalid_argument Si llenado está fuera de rango o la secuencia no está ordenada.
+ * @note Los valores repetidos consecutivos se cargan una sola vez.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Iterador>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::CargarOrdenado(Iterador inicio, Iterador fin, double llenado) {
+    if (llenado < 2.0 / 3.0 - 1e-9 || llenado > 1.0) {
+        throw std::invalid_argument("El llenado debe estar entre 2/3 y 1");
+    }
 
-    if (actual->elemNodo < grado) {
-        std::cout << "Advertencia: Nodo no está lleno aún para redistribuir\n";
-        return;
+    std::vector<Type> claves;
+    for (; inicio != fin; ++inicio) {
+        if (!claves.empty()) {
+            if (comparar(*inicio, claves.back())) throw std::invalid_argument("La secuencia no está ordenada");
+            if (!comparar(claves.back(), *inicio)) continue;
+        }
+        claves.push_back(*inicio);
     }
 
-    // Intentar redistribuir hacia la izquierda
-    if (indiceH > 0) {
-        Nodo* izquierdo = padre->hijo[indiceH - 1];
-        if (izquierdo->elemNodo < grado) {
-            std::cout << "Redistribuyendo hacia la izquierda con hijo[" << indiceH - 1 << "]\n";
+    Vaciar();
+    if (claves.empty()) return;
+    cantElem = claves.size();
 
-            // Mover clave del padre al final del izquierdo
-            izquierdo->claves[izquierdo->elemNodo] = padre->claves[indiceH - 1];
-            if (!esHoja)
-                izquierdo->hijo[izquierdo->elemNodo + 1] = actual->hijo[0];
-            izquierdo->elemNodo++;
+    int objetivo = static_cast<int>(std::lround(llenado * (grado - 1)));
+    if (objetivo < minClaves) objetivo = minClaves;
+    if (objetivo < 1) objetivo = 1;
 
-            // Subir primera clave de actual al padre
-            padre->claves[indiceH - 1] = actual->claves[0];
+    std::vector<Nodo*> hijos;   // Nodos del nivel inferior ya construido
+    std::vector<Nodo*> nivel;
+    std::vector<Type> separadores;
 
-            // Desplazar claves e hijos del actual hacia la izquierda
-            for (int j = 0; j < actual->elemNodo - 1; ++j) {
-                actual->claves[j] = actual->claves[j + 1];
-                if (!esHoja)
-                    actual->hijo[j] = actual->hijo[j + 1];
-            }
-            if (!esHoja)
-                actual->hijo[actual->elemNodo - 1] = actual->hijo[actual->elemNodo];
-            actual->elemNodo--;
+    while (true) {
+        int total = claves.size();
 
-            return;
+        // Cada nodo lleva 'objetivo' claves más una separadora hacia el nivel superior
+        int nodos = (total + objetivo + 1) / (objetivo + 1);
+        if (nodos < 1) nodos = 1;
+        // Evitar nodos por debajo del mínimo si caben en uno menos
+        while (nodos > 1 && (total - nodos + 1) / nodos < minClaves
+               && total - nodos + 2 <= (nodos - 1) * (grado - 1)) {
+            --nodos;
         }
-    }
 
-    // Intentar redistribuir hacia la derecha
-    if (indiceH < padre->elemNodo) {
-        Nodo* derecho = padre->hijo[indiceH + 1];
-        if (derecho->elemNodo < grado) {
-            std::cout << "Redistribuyendo hacia la derecha con hijo[" << indiceH + 1 << "]\n";
+        int base = (total - nodos + 1) / nodos;
+        int resto = (total - nodos + 1) % nodos;
 
-            // Desplazar claves e hijos del derecho hacia la derecha
-            for (int j = derecho->elemNodo; j > 0; --j) {
-                derecho->claves[j] = derecho->claves[j - 1];
-                if (!esHoja)
-                    derecho->hijo[j + 1] = derecho->hijo[j];
+        nivel.clear();
+        separadores.clear();
+        int idx = 0;
+        int idxHijo = 0;
+        for (int j = 0; j < nodos; ++j) {
+            Nodo* nodo = CrearNodo(hijos.empty());
+            int cantidad = base + (j < resto ? 1 : 0);
+            for (int k = 0; k < cantidad; ++k) {
+                nodo->claves[k] = std::move(claves[idx++]);
             }
-            if (!esHoja)
-                derecho->hijo[1] = derecho->hijo[0];
-
-            // Mover clave del padre al inicio del derecho
-            derecho->claves[0] = padre->claves[indiceH];
-            if (!esHoja)
-                derecho->hijo[0] = actual->hijo[actual->elemNodo];
-            derecho->elemNodo++;
-
-            // Subir última clave de actual al padre
-            padre->claves[indiceH] = actual->claves[actual->elemNodo - 1];
-            actual->elemNodo--;
+            nodo->elemNodo = cantidad;
+            if (!hijos.empty()) {
+                for (int k = 0; k <= cantidad; ++k) {
+                    ComoInterno(nodo)->hijo[k] = hijos[idxHijo++];
+                }
+                Recontar(ComoInterno(nodo), 0, cantidad);
+            }
+            if (j < nodos - 1) separadores.push_back(std::move(claves[idx++]));
+            nivel.push_back(nodo);
+        }
 
+        if (nodos == 1) {
+            raiz = nivel[0];
             return;
         }
+
+        claves.swap(separadores);
+        hijos.swap(nivel);
     }
+}
 
-    // Si no se pudo redistribuir: dividir triple
-    std::cout << "No se pudo redistribuir, realizando división triple\n";
-    DividirTriple(padre, indiceH);
+/**
+ * @brief Escribe una imagen binaria del árbol que StarBTreeImagen puede proyectar en memoria.
+ *
+ * Los nodos se escriben por niveles con un tamaño fijo de grado - 1 claves; los hijos de
+ * cada nodo quedan consecutivos y solo se guarda el índice del primero. La cabecera se
+ * escribe al final, cuando ya se conoce la suma de verificación de los nodos.
+ *
+ * @param ruta Ruta del archivo a crear o reemplazar.
+ * @throws std::runtime_error Si el archivo no se puede escribir.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Guardar(const std::string& ruta) const {
+    static_assert(!conCarga, "La imagen guarda solo claves");
+    using Imagen = StarBTreeImagen<Type, Compare>;
+    typename Imagen::Cabecera cabecera = {};
+    cabecera.firma = Imagen::firmaImagen;
+    cabecera.version = Imagen::versionImagen;
+    cabecera.tamClave = sizeof(Type);
+    cabecera.clavesPorNodo = grado - 1;
+    cabecera.cantElem = cantElem;
+    cabecera.tamRegistro = Imagen::TamRegistro(grado - 1);
+    cabecera.sumaVerificacion = Imagen::semillaSuma;
+
+    std::ofstream archivo(ruta, std::ios::binary | std::ios::trunc);
+    if (!archivo) throw std::runtime_error("No se pudo crear la imagen " + ruta);
+    archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+
+    std::vector<unsigned char> registro(cabecera.tamRegistro);
+    std::queue<const Nodo*> cola;
+    std::uint32_t siguiente = 1; // Índice que recibirá el próximo hijo encolado
+    if (raiz != nullptr) cola.push(raiz);
+
+    while (!cola.empty()) {
+        const Nodo* nodo = cola.front();
+        cola.pop();
+
+        std::uint32_t encabezado[2] = { static_cast<std::uint32_t>(nodo->elemNodo), 0 };
+        if (!EsHoja(nodo)) {
+            encabezado[1] = siguiente;
+            siguiente += nodo->elemNodo + 1;
+            for (int i = 0; i <= nodo->elemNodo; ++i) {
+                cola.push(ComoInterno(nodo)->hijo[i]);
+            }
+        }
 
-    // Si el padre es la raíz y se llena, dividir la raíz
-    if (padre == raiz && padre->elemNodo == grado) {
-        std::cout << "La raíz se llenó tras división triple, dividiéndola\n";
-        OrdenarNodo(raiz, 0); // Suficiente con un índice, OrdenarNodo revisa si es necesario
+        std::fill(registro.begin(), registro.end(), 0);
+        std::memcpy(registro.data(), encabezado, sizeof(encabezado));
+        std::memcpy(registro.data() + Imagen::desplClaves, nodo->claves, nodo->elemNodo * sizeof(Type));
+        cabecera.sumaVerificacion = Imagen::Sumar(cabecera.sumaVerificacion, registro.data(), registro.size());
+        archivo.write(reinterpret_cast<const char*>(registro.data()), registro.size());
+        cabecera.cantNodos++;
     }
-}*/
 
+    archivo.seekp(0);
+    archivo.write(reinterpret_cast<const char*>(&cabecera), sizeof(cabecera));
+    archivo.flush();
+    if (!archivo) throw std::runtime_error("No se pudo escribir la imagen " + ruta);
+}
 
 /**
- * @brief Realiza una división triple en un nodo y sus hermanos.
- * @param padre Nodo padre.
- * @param indiceHijo Índice del hijo medio a dividir.
+ * @brief Elimina todos los elementos del árbol.
+ * 
+ * Libera toda la memoria dinámica y reinicia el árbol.
  */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Vaciar() {
+    if (instantaneas.load(std::memory_order_acquire) > 0) {
+        // Los nodos compartidos siguen siendo de las instantáneas: solo se sueltan
+        if (raiz != nullptr) Soltar(raiz);
+        raiz = nullptr;
+        cantElem = 0;
+        return;
+    }
 
-template <typename Type, int grado>
-void StarBTree<Type, grado>::DividirTriple(Nodo* padre, int indiceHijo) {
-    std::cout << "=== DIVISIÓN TRIPLE ===" << std::endl;
-
-    Nodo* medio = padre->hijo[indiceHijo];
-    Nodo* izquierdo = (indiceHijo > 0) ? padre->hijo[indiceHijo - 1] : nullptr;
-    Nodo* derecho = (indiceHijo < padre->elemNodo) ? padre->hijo[indiceHijo + 1] : nullptr;
-
-    // Escoger hermano para fusionar
-    bool usarIzquierdo = (izquierdo && izquierdo->elemNodo == grado);
-    bool usarDerecho = (derecho && derecho->elemNodo == grado);
+    // Si claves y cargas no requieren destructor, el pool libera sus bloques sin recorrer el árbol
+    if constexpr (!(Asignador<Interno>::liberacionMasiva && Asignador<Hoja>::liberacionMasiva
+                    && std::is_trivially_destructible<Nodo>::value)) {
+        Vaciar(raiz);
+    }
+    asignadorInterno.LiberarTodo();
+    asignadorHoja.LiberarTodo();
+    raiz = nullptr;  ///< Importante resetear la raíz
+    cantElem = 0;    ///< Resetear el contador de elementos
+}
 
-    int posFusion = -1;
-    Nodo *A, *B, *C; // nuevos nodos
-    std::vector<Type> fusion;
-    std::vector<Nodo*> fusionHijos;
+/**
+ * @brief Elimina todos los nodos del subárbol de forma recursiva.
+ * 
+ * @param nodo Nodo raíz del subárbol a eliminar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Vaciar(Nodo* nodo) {
+    if (nodo == nullptr) return;
 
-    if (usarIzquierdo) {
-        posFusion = indiceHijo - 1;
-        for (int i = 0; i < izquierdo->elemNodo; ++i)
-            fusion.push_back(izquierdo->claves[i]);
-        fusion.push_back(padre->claves[posFusion]);
-        for (int i = 0; i < medio->elemNodo; ++i)
-            fusion.push_back(medio->claves[i]);
-
-        if (!EsHoja(medio)) {
-            for (int i = 0; i <= izquierdo->elemNodo; ++i)
-                fusionHijos.push_back(izquierdo->hijo[i]);
-            for (int i = 0; i <= medio->elemNodo; ++i)
-                fusionHijos.push_back(medio->hijo[i]);
-        }
-    } else if (usarDerecho) {
-        posFusion = indiceHijo;
-        for (int i = 0; i < medio->elemNodo; ++i)
-            fusion.push_back(medio->claves[i]);
-        fusion.push_back(padre->claves[posFusion]);
-        for (int i = 0; i < derecho->elemNodo; ++i)
-            fusion.push_back(derecho->claves[i]);
-
-        if (!EsHoja(medio)) {
-            for (int i = 0; i <= medio->elemNodo; ++i)
-                fusionHijos.push_back(medio->hijo[i]);
-            for (int i = 0; i <= derecho->elemNodo; ++i)
-                fusionHijos.push_back(derecho->hijo[i]);
+    if (!EsHoja(nodo)) {
+        Interno* interno = ComoInterno(nodo);
+        for (int i = 0; i <= nodo->elemNodo; ++i) {
+            Vaciar(interno->hijo[i]);
+            interno->hijo[i] = nullptr;
         }
-    } else {
-        std::cout << "No se puede dividir triple (no hay hermanos llenos)." << std::endl;
-        return;
     }
 
-    // Crear nodos
-    A = new Nodo();
-    B = new Nodo();
-    C = new Nodo();
-
-    int total = fusion.size();
-    int porcion = (total / 3) - 1; ////////////////////////////////////////////////////////////////////////////////
-
-    for (int i = 0; i < porcion; ++i)
-        A->claves[A->elemNodo++] = fusion[i];
+    Destruir(nodo);
+}
 
-    padre->claves[posFusion] = fusion[porcion];
+/**
+ * @brief Iterador al menor elemento del árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::begin() const {
+    const_iterator it(raiz);
+    if (raiz != nullptr && raiz->elemNodo > 0) it.BajarIzquierda(raiz);
+    return it;
+}
 
-    for (int i = porcion + 1; i < 2 * porcion + 1; ++i)
-        B->claves[B->elemNodo++] = fusion[i];
+/**
+ * @brief Iterador al final (una posición después del mayor elemento).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::end() const {
+    return const_iterator(raiz);
+}
 
-    padre->claves[posFusion + 1] = fusion[2 * porcion + 1];
+/**
+ * @brief Iterador inverso al mayor elemento del árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_reverse_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::rbegin() const {
+    return const_reverse_iterator(end());
+}
 
-    for (int i = 2 * porcion + 2; i < total; ++i)
-        C->claves[C->elemNodo++] = fusion[i];
+/**
+ * @brief Iterador inverso al final del recorrido descendente.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_reverse_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::rend() const {
+    return const_reverse_iterator(begin());
+}
 
-    // Si no son hojas, distribuir hijos
-    if (!fusionHijos.empty()) {
-        int idx = 0;
-        for (int i = 0; i <= A->elemNodo; ++i)
-            A->hijo[i] = fusionHijos[idx++];
-        for (int i = 0; i <= B->elemNodo; ++i)
-            B->hijo[i] = fusionHijos[idx++];
-        for (int i = 0; i <= C->elemNodo; ++i)
-            C->hijo[i] = fusionHijos[idx++];
+/**
+ * @brief Busca el primer elemento que no es menor que valor.
+ * @param valor Valor de referencia.
+ * @return Iterador al elemento, o end() si todos son menores.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::lower_bound(const Type& valor) const {
+    const_iterator it(raiz);
+    const Nodo* nodo = raiz;
+    while (nodo != nullptr) {
+        int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+        it.Apilar(nodo, i);
+        if (i < nodo->elemNodo && !comparar(valor, nodo->claves[i])) return it;
+        if (EsHoja(nodo)) break;
+        nodo = ComoInterno(nodo)->hijo[i];
     }
+    // Se terminó después de la última clave de la hoja: el siguiente está en un ancestro
+    if (it.profundidad > 0 && it.camino[it.profundidad - 1].indice == nodo->elemNodo) it.Subir();
+    return it;
+}
 
-    // Desplazar claves y punteros en padre
-    for (int i = padre->elemNodo; i > posFusion + 1; --i) {
-        padre->claves[i] = padre->claves[i - 1];
-        padre->hijo[i + 1] = padre->hijo[i];
+/**
+ * @brief Busca el primer elemento mayor que valor.
+ * @param valor Valor de referencia.
+ * @return Iterador al elemento, o end() si ninguno es mayor.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::upper_bound(const Type& valor) const {
+    const_iterator it(raiz);
+    const Nodo* nodo = raiz;
+    while (nodo != nullptr) {
+        int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+        if (i < nodo->elemNodo && !comparar(valor, nodo->claves[i])) ++i;
+        it.Apilar(nodo, i);
+        if (EsHoja(nodo)) break;
+        nodo = ComoInterno(nodo)->hijo[i];
     }
-    padre->elemNodo++;
-
-    padre->hijo[posFusion]     = A;
-    padre->hijo[posFusion + 1] = B;
-    padre->hijo[posFusion + 2] = C;
+    if (it.profundidad > 0 && it.camino[it.profundidad - 1].indice == nodo->elemNodo) it.Subir();
+    return it;
+}
 
-    if (usarIzquierdo) {
-        delete izquierdo;
-        delete medio;
-    } else {
-        delete medio;
-        delete derecho;
-    }
+/**
+ * @brief Rango de elementos equivalentes a valor (a lo sumo uno, las claves son únicas).
+ * @param valor Valor de referencia.
+ * @return Par (lower_bound(valor), upper_bound(valor)).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+std::pair<typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator,
+          typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::equal_range(const Type& valor) const {
+    return std::make_pair(lower_bound(valor), upper_bound(valor));
 }
 
+/**
+ * @brief Visita en orden ascendente los elementos del intervalo cerrado [desde, hasta].
+ *
+ * Solo se visitan los nodos que intersecan el intervalo: O(log n + k) en total.
+ * Si fn devuelve bool, un valor false detiene el recorrido.
+ *
+ * @param desde Límite inferior (incluido).
+ * @param hasta Límite superior (incluido).
+ * @param fn Función invocada con cada elemento.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Funcion>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const {
+    if (raiz == nullptr || comparar(hasta, desde)) return;
+    RecorrerRango(raiz, desde, hasta, fn);
+}
 
 /**
- * @brief Verifica si un nodo es hoja.
- * 
- * Un nodo es hoja si todos sus hijos son nulos.
- * 
- * @tparam Type Tipo de dato almacenado en el árbol.
- * @tparam grado Grado del árbol B*.
- * @param nodo Nodo a verificar.
- * @return true si es hoja, false en caso contrario.
+ * @brief Función auxiliar recursiva de RecorrerRango.
+ * @return false si el recorrido debe detenerse.
  */
-template <typename Type, int grado>
-bool StarBTree<Type, grado>::EsHoja(Nodo* nodo) const {
-    if(nodo == nullptr) return true;
-    for(int i = 0; i <= nodo->elemNodo; ++i) {
-        if(nodo->hijo[i] != nullptr) {
-            return false;
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Funcion>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RecorrerRango(const Nodo* nodo, const Type& desde, const Type& hasta, Funcion& fn) const {
+    bool hoja = EsHoja(nodo);
+    int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, desde, comparar);
+
+    for (; i < nodo->elemNodo; ++i) {
+        if (!hoja && !RecorrerRango(ComoInterno(nodo)->hijo[i], desde, hasta, fn)) return false;
+        if (comparar(hasta, nodo->claves[i])) return false;
+
+        if constexpr (std::is_same<decltype(fn(nodo->claves[i])), bool>::value) {
+            if (!fn(nodo->claves[i])) return false;
+        } else {
+            fn(nodo->claves[i]);
         }
     }
-    return true;
+    return hoja || RecorrerRango(ComoInterno(nodo)->hijo[nodo->elemNodo], desde, hasta, fn);
 }
 
 /**
- * @brief Busca un valor en el árbol.
- * 
- * @tparam Type Tipo de dato almacenado en el árbol.
- * @tparam grado Grado del árbol B*.
- * @param valor Valor a buscar.
- * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ * @brief Constructor por copia del iterador; solo copia la parte usada del camino.
  */
-template <typename Type, int grado>
-bool StarBTree<Type, grado>::Buscar(Type valor) const {
-    return Buscar(valor, raiz);
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::const_iterator(const const_iterator& c)
+    : raizArbol(c.raizArbol), profundidad(c.profundidad) {
+    for (int i = 0; i < profundidad; ++i) camino[i] = c.camino[i];
 }
 
 /**
- * @brief Función auxiliar recursiva para buscar un valor.
- * 
- * @param valor Valor a buscar.
- * @param subraiz Subárbol en el que se realiza la búsqueda.
- * @return true si el valor se encuentra, false en caso contrario.
+ * @brief Asignación del iterador; solo copia la parte usada del camino.
  */
-template <typename Type, int grado>
-bool StarBTree<Type, grado>::Buscar(Type valor, Nodo* subraiz) const {
-    if(subraiz == nullptr) return false;
-    
-    int i = 0;
-    while(i < subraiz->elemNodo && valor > subraiz->claves[i]) {
-        ++i;
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator&
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::operator=(const const_iterator& c) {
+    raizArbol = c.raizArbol;
+    profundidad = c.profundidad;
+    for (int i = 0; i < profundidad; ++i) camino[i] = c.camino[i];
+    return *this;
+}
+
+/**
+ * @brief Avanza al sucesor en orden.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator&
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::operator++() {
+    Paso& tope = camino[profundidad - 1];
+    if (!tope.nodo->hoja) {
+        // Nodo interno: el sucesor es el mínimo del subárbol derecho de la clave
+        ++tope.indice;
+        BajarIzquierda(ComoInterno(tope.nodo)->hijo[tope.indice]);
+    } else if (++tope.indice == tope.nodo->elemNodo) {
+        Subir();
     }
-    
-    if(i < subraiz->elemNodo && valor == subraiz->claves[i]) {
-        return true;
+    return *this;
+}
+
+/**
+ * @brief Retrocede al predecesor en orden; desde end() va al mayor elemento.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator&
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::operator--() {
+    if (profundidad == 0) {
+        BajarDerecha(raizArbol);
+        return *this;
     }
-    
-    return Buscar(valor, subraiz->hijo[i]);
+
+    Paso& tope = camino[profundidad - 1];
+    if (!tope.nodo->hoja) {
+        // Nodo interno: el predecesor es el máximo del subárbol izquierdo de la clave
+        BajarDerecha(ComoInterno(tope.nodo)->hijo[tope.indice]);
+    } else if (tope.indice > 0) {
+        --tope.indice;
+    } else {
+        // Primera clave de la hoja: subir hasta un ancestro al que se llegó por un hijo distinto del primero
+        --profundidad;
+        while (profundidad > 0 && camino[profundidad - 1].indice == 0) --profundidad;
+        if (profundidad > 0) --camino[profundidad - 1].indice;
+    }
+    return *this;
 }
 
 /**
- * @brief Elimina todos los elementos del árbol.
- * 
- * Libera toda la memoria dinámica y reinicia el árbol.
+ * @brief Dos iteradores son iguales si apuntan a la misma clave del mismo nodo.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::Vaciar() {
-    Vaciar(raiz);
-    raiz = nullptr;  ///< Importante resetear la raíz
-    cantElem = 0;    ///< Resetear el contador de elementos
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::operator==(const const_iterator& c) const {
+    if (profundidad == 0 || c.profundidad == 0) return profundidad == c.profundidad;
+    return camino[profundidad - 1].nodo == c.camino[c.profundidad - 1].nodo
+        && camino[profundidad - 1].indice == c.camino[c.profundidad - 1].indice;
 }
 
 /**
- * @brief Elimina todos los nodos del subárbol de forma recursiva.
- * 
- * @param nodo Nodo raíz del subárbol a eliminar.
+ * @brief Baja por el primer hijo hasta la hoja, dejando el iterador en su primera clave.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::Vaciar(Nodo* nodo) {
-    if (nodo == nullptr) return;
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::BajarIzquierda(const Nodo* nodo) {
+    while (!nodo->hoja) {
+        Apilar(nodo, 0);
+        nodo = ComoInterno(nodo)->hijo[0];
+    }
+    Apilar(nodo, 0);
+}
 
-    if (!EsHoja(nodo)) {
-        for (int i = 0; i <= nodo->elemNodo; ++i) {
-            Vaciar(nodo->hijo[i]);
-            nodo->hijo[i] = nullptr;
-        }
+/**
+ * @brief Baja por el último hijo hasta la hoja, dejando el iterador en su última clave.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::BajarDerecha(const Nodo* nodo) {
+    while (!nodo->hoja) {
+        Apilar(nodo, nodo->elemNodo);
+        nodo = ComoInterno(nodo)->hijo[nodo->elemNodo];
     }
+    Apilar(nodo, nodo->elemNodo - 1);
+}
 
-    delete nodo;
+/**
+ * @brief Sale de un nodo agotado hasta el primer ancestro con una clave pendiente.
+ *
+ * En el ancestro, el índice del hijo por el que se bajó coincide con la clave siguiente.
+ * Si no queda ninguno, el iterador pasa a end().
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator::Subir() {
+    --profundidad;
+    while (profundidad > 0 && camino[profundidad - 1].indice >= camino[profundidad - 1].nodo->elemNodo) {
+        --profundidad;
+    }
 }
 
 /**
@@ -663,8 +1799,8 @@ void StarBTree<Type, grado>::Vaciar(Nodo* nodo) {
  * 
  * Utiliza recorrido en orden (in-order).
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::ImprimirAsc() const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ImprimirAsc() const {
     ImprimirAsc(raiz);
     std::cout << std::endl;
 }
@@ -674,15 +1810,16 @@ void StarBTree<Type, grado>::ImprimirAsc() const {
  * 
  * @param nodo Nodo desde donde se inicia la impresión.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::ImprimirAsc(Nodo* nodo) const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ImprimirAsc(Nodo* nodo) const {
     if(nodo == nullptr) return;
+    const Interno* interno = EsHoja(nodo) ? nullptr : ComoInterno(nodo);
     
     for(int i = 0; i < nodo->elemNodo; ++i) {
-        ImprimirAsc(nodo->hijo[i]);
+        if(interno) ImprimirAsc(interno->hijo[i]);
         std::cout << nodo->claves[i] << " ";
     }
-    ImprimirAsc(nodo->hijo[nodo->elemNodo]);
+    if(interno) ImprimirAsc(interno->hijo[nodo->elemNodo]);
 }
 
 /**
@@ -690,8 +1827,8 @@ void StarBTree<Type, grado>::ImprimirAsc(Nodo* nodo) const {
  * 
  * Utiliza recorrido inverso (reverse in-order).
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::ImprimirDes() const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ImprimirDes() const {
     ImprimirDes(raiz);
     std::cout << std::endl;
 }
@@ -701,14 +1838,15 @@ void StarBTree<Type, grado>::ImprimirDes() const {
  * 
  * @param nodo Nodo desde donde se inicia la impresión.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::ImprimirDes(Nodo* nodo) const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ImprimirDes(Nodo* nodo) const {
     if(nodo == nullptr) return;
+    const Interno* interno = EsHoja(nodo) ? nullptr : ComoInterno(nodo);
     
-    ImprimirDes(nodo->hijo[nodo->elemNodo]);
+    if(interno) ImprimirDes(interno->hijo[nodo->elemNodo]);
     for(int i = nodo->elemNodo-1; i >= 0; --i) {
         std::cout << nodo->claves[i] << " ";
-        ImprimirDes(nodo->hijo[i]);
+        if(interno) ImprimirDes(interno->hijo[i]);
     }
 }
 
@@ -717,8 +1855,8 @@ void StarBTree<Type, grado>::ImprimirDes(Nodo* nodo) const {
  * 
  * Imprime cada nivel del árbol en una línea, útil para ver la estructura.
  */
-template <typename Type, int grado>
-void StarBTree<Type, grado>::ImprimirNiveles() const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ImprimirNiveles() const {
     if(raiz == nullptr) return;
     
     std::queue<Nodo*> cola;
@@ -740,9 +1878,7 @@ void StarBTree<Type, grado>::ImprimirNiveles() const {
             
             if(!EsHoja(actual)) {
                 for(int j = 0; j <= actual->elemNodo; ++j) {
-                    if(actual->hijo[j] != nullptr) {
-                        cola.push(actual->hijo[j]);
-                    }
+                    cola.push(ComoInterno(actual)->hijo[j]);
                 }
             }
         }
@@ -755,7 +1891,331 @@ void StarBTree<Type, grado>::ImprimirNiveles() const {
  * 
  * @return Número de elementos insertados actualmente en el árbol.
  */
-template <typename Type, int grado>
-int StarBTree<Type, grado>::CantElem() const {
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::CantElem() const {
     return cantElem;
 }
+
+/**
+ * @brief Devuelve la cantidad de niveles; todas las hojas están a la misma profundidad.
+ * @return Altura del árbol (0 si está vacío).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Altura() const {
+    int altura = 0;
+    for (const Nodo* nodo = raiz; nodo != nullptr; nodo = nodo->hoja ? nullptr : ComoInterno(nodo)->hijo[0]) {
+        ++altura;
+    }
+    return altura;
+}
+
+/**
+ * @brief Recorre el árbol y reúne su forma, su ocupación y los contadores acumulados.
+ * @return Estadísticas del árbol en este instante (O(nodos)).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+EstadisticasArbol StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Estadisticas() const {
+    EstadisticasArbol e;
+    e.elementos = cantElem;
+    e.contadores = contadores;
+    if (raiz == nullptr) return e;
+
+    Estadisticas(raiz, 0, e);
+    e.altura = static_cast<int>(e.nodosPorNivel.size());
+
+    std::size_t fueraDeRaiz = 0;
+    for (std::size_t cuenta : e.histogramaLlenado) fueraDeRaiz += cuenta;
+    if (fueraDeRaiz > 0) {
+        e.llenadoMedio = static_cast<double>(cantElem - raiz->elemNodo) / (fueraDeRaiz * (grado - 1));
+    }
+    return e;
+}
+
+/**
+ * @brief Acumula en e los nodos del subárbol: cuenta por nivel, llenado y memoria.
+ * @param nodo Raíz del subárbol.
+ * @param nivel Profundidad de nodo (0 para la raíz).
+ * @param e Estadísticas en construcción.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Estadisticas(const Nodo* nodo, int nivel, EstadisticasArbol& e) const {
+    if (static_cast<int>(e.nodosPorNivel.size()) <= nivel) e.nodosPorNivel.push_back(0);
+    e.nodosPorNivel[nivel]++;
+
+    if (nivel > 0) {
+        int cubeta = nodo->elemNodo * EstadisticasArbol::cubetas / (grado - 1);
+        if (cubeta >= EstadisticasArbol::cubetas) cubeta = EstadisticasArbol::cubetas - 1;
+        e.histogramaLlenado[cubeta]++;
+    }
+
+    if (EsHoja(nodo)) {
+        e.bytesNodos += sizeof(Hoja);
+        return;
+    }
+    e.bytesNodos += sizeof(Interno);
+    for (int i = 0; i <= nodo->elemNodo; ++i) {
+        Estadisticas(ComoInterno(nodo)->hijo[i], nivel + 1, e);
+    }
+}
+
+/**
+ * @brief Cuenta los elementos menores que valor.
+ * @param valor Valor de referencia (no necesita estar en el árbol).
+ * @return Posición que ocuparía valor en el recorrido en orden.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Rango(const Type& valor) const {
+    static_assert(conteos, "Rango requiere StarBTree con conteos = true");
+    return RangoHasta(valor, false);
+}
+
+/**
+ * @brief Devuelve el k-ésimo menor elemento bajando por los conteos de cada nivel.
+ * @param k Posición en el orden, desde 0.
+ * @return Referencia al elemento (válida hasta la próxima modificación).
+ * @throws std::out_of_range Si k no está en [0, CantElem()).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+const Type& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Seleccionar(int k) const {
+    static_assert(conteos, "Seleccionar requiere StarBTree con conteos = true");
+    if (k < 0 || k >= cantElem) throw std::out_of_range("Posición fuera del árbol");
+
+    const Nodo* nodo = raiz;
+    while (!EsHoja(nodo)) {
+        const Interno* interno = ComoInterno(nodo);
+        int j = 0;
+        // Saltar los subárboles (y sus separadoras) que quedan enteros antes de k
+        while (k >= interno->conteo[j]) {
+            k -= interno->conteo[j];
+            if (k == 0) return nodo->claves[j];
+            --k;
+            ++j;
+        }
+        nodo = interno->hijo[j];
+    }
+    return nodo->claves[k];
+}
+
+/**
+ * @brief Cuenta los elementos en [desde, hasta] con dos descensos.
+ * @param desde Límite inferior (inclusivo).
+ * @param hasta Límite superior (inclusivo).
+ * @return Cantidad de elementos en el intervalo (0 si hasta < desde).
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ContarRango(const Type& desde, const Type& hasta) const {
+    static_assert(conteos, "ContarRango requiere StarBTree con conteos = true");
+    if (comparar(hasta, desde)) return 0;
+    return RangoHasta(hasta, true) - RangoHasta(desde, false);
+}
+
+/**
+ * @brief Devuelve el elemento en la fracción p del orden (0 el menor, 1 el mayor).
+ * @param p Fracción en [0, 1]; los valores fuera se recortan.
+ * @return Elemento en la posición redondeada p * (CantElem() - 1).
+ * @throws std::out_of_range Si el árbol está vacío.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+const Type& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Percentil(double p) const {
+    static_assert(conteos, "Percentil requiere StarBTree con conteos = true");
+    if (cantElem == 0) throw std::out_of_range("El árbol está vacío");
+    if (p < 0) p = 0;
+    if (p > 1) p = 1;
+    return Seleccionar(static_cast<int>(std::lround(p * (cantElem - 1))));
+}
+
+/**
+ * @brief Cuenta los elementos menores que valor (o menores o iguales) en un solo descenso.
+ *
+ * En cada nivel se suman las claves a la izquierda de la posición y los conteos de los
+ * hijos que quedan enteros a su izquierda.
+ *
+ * @param valor Valor de referencia.
+ * @param incluir true para contar también el elemento igual a valor.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::RangoHasta(const Type& valor, bool incluir) const {
+    int rango = 0;
+    const Nodo* nodo = raiz;
+    while (nodo != nullptr) {
+        int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+        bool igual = i < nodo->elemNodo && !comparar(valor, nodo->claves[i]);
+        rango += i;
+        if (EsHoja(nodo)) return rango + (igual && incluir);
+
+        const Interno* interno = ComoInterno(nodo);
+        for (int j = 0; j < i; ++j) rango += interno->conteo[j];
+        if (igual) return rango + interno->conteo[i] + incluir;
+        nodo = interno->hijo[i];
+    }
+    return rango;
+}
+
+/**
+ * @brief Cantidad de elementos del subárbol, a partir de los conteos guardados en el nodo.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+int StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Tamano(const Nodo* nodo) {
+    int total = nodo->elemNodo;
+    if constexpr (conteos) {
+        if (!nodo->hoja) {
+            for (int i = 0; i <= nodo->elemNodo; ++i) total += ComoInterno(nodo)->conteo[i];
+        }
+    }
+    return total;
+}
+
+/**
+ * @brief Recalcula los conteos de padre->hijo[desde..hasta] tras reorganizarlos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Recontar(Interno* padre, int desde, int hasta) {
+    if constexpr (conteos) {
+        for (int i = desde; i <= hasta; ++i) padre->conteo[i] = Tamano(padre->hijo[i]);
+    }
+}
+
+/**
+ * @brief Ajusta el conteo de un hijo cuyo subárbol ganó o perdió elementos.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Sumar(Interno* padre, int indice, int delta) {
+    if constexpr (conteos) padre->conteo[indice] += delta;
+}
+
+/**
+ * @brief Crea una instantánea del contenido actual en O(1).
+ *
+ * La raíz gana una referencia; a partir de aquí el árbol copia los nodos compartidos
+ * antes de modificarlos.
+ *
+ * @return Vista de solo lectura; debe destruirse antes que el árbol.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::TomarInstantanea() {
+    static_assert(!conCarga, "Las cargas se modifican en el lugar y no quedarían congeladas en la vista");
+    instantaneas.fetch_add(1, std::memory_order_acq_rel);
+    if (raiz != nullptr) Referenciar(raiz);
+    return Instantanea(this, raiz, cantElem);
+}
+
+/**
+ * @brief Copia de una instantánea: comparte la misma raíz.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::Instantanea(const Instantanea& c) : arbol(c.arbol), raiz(c.raiz), cantElem(c.cantElem) {
+    if (arbol == nullptr) return;
+    arbol->instantaneas.fetch_add(1, std::memory_order_acq_rel);
+    if (raiz != nullptr) arbol->Referenciar(raiz);
+}
+
+/**
+ * @brief Movimiento de una instantánea; c queda vacía.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::Instantanea(Instantanea&& c) noexcept : arbol(c.arbol), raiz(c.raiz), cantElem(c.cantElem) {
+    c.arbol = nullptr;
+    c.raiz = nullptr;
+    c.cantElem = 0;
+}
+
+/**
+ * @brief Asignación por copia e intercambio.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::operator=(Instantanea c) noexcept {
+    std::swap(arbol, c.arbol);
+    std::swap(raiz, c.raiz);
+    std::swap(cantElem, c.cantElem);
+    return *this;
+}
+
+/**
+ * @brief Suelta la raíz de la instantánea; libera los nodos que el árbol ya no usa.
+ *
+ * Puede ejecutarse en otro hilo mientras el árbol inserta: el pool queda protegido por
+ * candado hasta que se descuenta esta instantánea.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::~Instantanea() {
+    if (arbol == nullptr) return;
+    if (raiz != nullptr) arbol->Soltar(raiz);
+    arbol->instantaneas.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Busca un valor en la instantánea.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+bool StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::Buscar(const Type& valor) const {
+    return arbol != nullptr && arbol->Buscar(valor, raiz);
+}
+
+/**
+ * @brief Iterador al menor elemento de la instantánea.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+typename StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::const_iterator StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::begin() const {
+    const_iterator it(raiz);
+    if (raiz != nullptr && raiz->elemNodo > 0) it.BajarIzquierda(raiz);
+    return it;
+}
+
+/**
+ * @brief Visita en orden los elementos de la instantánea en [desde, hasta].
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+template <typename Funcion>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Instantanea::RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const {
+    if (raiz == nullptr || arbol->comparar(hasta, desde)) return;
+    arbol->RecorrerRango(raiz, desde, hasta, fn);
+}
+
+/**
+ * @brief Devuelve la política de traza asociada al árbol.
+ *
+ * @return Referencia a la política, para consultar el estado acumulado por un observador.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+Traza& StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::ObtenerTraza() {
+    return traza;
+}
+
+/**
+ * @brief Cuenta un evento estructural y lo entrega a la política de traza.
+ *
+ * Con TrazaNula, que no lleva contadores ni recibe eventos, no genera código.
+ *
+ * @param tipo Tipo de evento.
+ * @param indiceHijo Índice del hijo que origina el evento.
+ * @param indiceHermano Índice del hermano involucrado, o -1.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Notificar(TipoEvento tipo, int indiceHijo, int indiceHermano) {
+    if constexpr (Traza::contadores) {
+        switch (tipo) {
+            case TipoEvento::Descenso: contadores.descensos++; break;
+            case TipoEvento::RedistribucionIzquierda: contadores.redistribucionesIzquierda++; break;
+            case TipoEvento::RedistribucionDerecha: contadores.redistribucionesDerecha++; break;
+            case TipoEvento::DivisionTriple: contadores.divisionesTriples++; break;
+            case TipoEvento::DivisionDoble: contadores.divisionesDobles++; break;
+            case TipoEvento::DivisionRaiz: contadores.divisionesRaiz++; break;
+            case TipoEvento::Fusion: contadores.fusiones++; break;
+            case TipoEvento::ContraccionRaiz: contadores.contraccionesRaiz++; break;
+        }
+    }
+
+    if constexpr (Traza::activa) {
+        traza.Notificar(EventoTraza{tipo, indiceHijo, indiceHermano});
+    }
+}
+
+/**
+ * @brief Suma a uno de los contadores de costo, si la política de traza los lleva.
+ * @param contador Contador a incrementar.
+ * @param n Cantidad a sumar.
+ */
+template <typename Type, int grado, typename Traza, template <typename> class Asignador, typename Compare, bool conteos, typename Desborde, typename Carga>
+void StarBTree<Type, grado, Traza, Asignador, Compare, conteos, Desborde, Carga>::Contar(std::uint64_t ContadoresArbol::*contador, std::uint64_t n) {
+    if constexpr (Traza::contadores) contadores.*contador += n;
+}
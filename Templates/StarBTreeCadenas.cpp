@@ -0,0 +1,527 @@
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include "../Headers/StarBTreeCadenas.hpp"
+
+/**
+ * @file StarBTreeCadenas.tpp
+ * @brief Implementación del Árbol B* de cadenas con prefijos comprimidos.
+ * @details Las claves de un nodo nunca se copian a std::string para compararlas: se leen
+ * como vistas sobre el área del nodo. Cada modificación codifica primero todos los nodos
+ * afectados en los búferes temporales y recién después los asigna, porque las vistas de
+ * origen apuntan a las áreas que se reemplazan. Toda reorganización pasa por Repartir.
+ * @tparam grado Grado del árbol (número máximo de claves por nodo más uno).
+ * @tparam Desborde Política de desborde (ver PoliticaDesborde).
+ */
+
+/**
+ * @brief Constructor por defecto: árbol vacío.
+ */
+template <int grado, typename Desborde>
+StarBTreeCadenas<grado, Desborde>::StarBTreeCadenas() : raiz(nullptr), cantElem(0) {}
+
+/**
+ * @brief Destructor: libera los nodos y sus áreas de claves.
+ */
+template <int grado, typename Desborde>
+StarBTreeCadenas<grado, Desborde>::~StarBTreeCadenas() {
+    Vaciar();
+}
+
+/**
+ * @brief Devuelve la i-ésima clave de un nodo como prefijo más sufijo.
+ * @param nodo Nodo que contiene la clave.
+ * @param i Índice de la clave.
+ * @return Vistas sobre el área del nodo (válidas hasta que el nodo se recodifique).
+ */
+template <int grado, typename Desborde>
+typename StarBTreeCadenas<grado, Desborde>::Trozo StarBTreeCadenas<grado, Desborde>::Clave(const Nodo* nodo, int i) {
+    std::uint32_t inicio = (i == 0) ? 0 : nodo->fin[i - 1];
+    const char* sufijos = nodo->area + nodo->tamPrefijo;
+    return Trozo{std::string_view(nodo->area, nodo->tamPrefijo),
+                 std::string_view(sufijos + inicio, nodo->fin[i] - inicio)};
+}
+
+/**
+ * @brief Compara una cadena con una clave guardada en un nodo.
+ * @param valor Cadena a comparar.
+ * @param clave Clave vista como prefijo más sufijo.
+ * @return Negativo, cero o positivo si valor es menor, igual o mayor que la clave.
+ */
+template <int grado, typename Desborde>
+int StarBTreeCadenas<grado, Desborde>::Comparar(std::string_view valor, const Trozo& clave) {
+    // Si valor es más corto que el prefijo y coincide con su comienzo, compare ya es negativo
+    int c = valor.compare(0, clave.prefijo.size(), clave.prefijo);
+    if (c != 0) return c;
+    return valor.substr(clave.prefijo.size()).compare(clave.sufijo);
+}
+
+/**
+ * @brief Busca la primera clave del nodo que no es menor que valor.
+ *
+ * El prefijo del nodo se compara una sola vez: si valor no lo comparte, queda antes o
+ * después de todas las claves; si lo comparte, la búsqueda binaria solo mira sufijos.
+ *
+ * @param nodo Nodo donde buscar.
+ * @param valor Cadena buscada.
+ * @param encontrado Se pone en true si la clave en la posición devuelta es igual a valor.
+ * @return Índice de la primera clave >= valor (elemNodo si todas son menores).
+ */
+template <int grado, typename Desborde>
+int StarBTreeCadenas<grado, Desborde>::Posicion(const Nodo* nodo, std::string_view valor, bool& encontrado) {
+    encontrado = false;
+    std::string_view prefijo(nodo->area, nodo->tamPrefijo);
+    int c = valor.compare(0, prefijo.size(), prefijo);
+    if (c < 0) return 0;
+    if (c > 0) return nodo->elemNodo;
+
+    std::string_view resto = valor.substr(prefijo.size());
+    const char* sufijos = nodo->area + nodo->tamPrefijo;
+    int izq = 0;
+    int der = nodo->elemNodo;
+    while (izq < der) {
+        int medio = izq + (der - izq) / 2;
+        std::uint32_t inicio = (medio == 0) ? 0 : nodo->fin[medio - 1];
+        std::string_view sufijo(sufijos + inicio, nodo->fin[medio] - inicio);
+        int r = sufijo.compare(resto);
+        if (r < 0) {
+            izq = medio + 1;
+        } else {
+            if (r == 0) {
+                encontrado = true;
+                return medio;
+            }
+            der = medio;
+        }
+    }
+    return izq;
+}
+
+/**
+ * @brief Codifica claves ordenadas en un búfer temporal: prefijo común y sufijos contiguos.
+ * @param claves Claves en orden (pueden venir de nodos distintos).
+ * @param n Cantidad de claves.
+ * @param destino Búfer donde queda la codificación.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::Codificar(const Trozo* claves, int n, Codificado& destino) {
+    auto longitud = [](const Trozo& t) { return t.prefijo.size() + t.sufijo.size(); };
+    auto letra = [](const Trozo& t, std::size_t k) {
+        return k < t.prefijo.size() ? t.prefijo[k] : t.sufijo[k - t.prefijo.size()];
+    };
+    auto copiar = [](const Trozo& t, std::size_t desde, char* salida) {
+        std::size_t escritos = 0;
+        if (desde < t.prefijo.size()) {
+            escritos = t.prefijo.size() - desde;
+            std::memcpy(salida, t.prefijo.data() + desde, escritos);
+            desde = 0;
+        } else {
+            desde -= t.prefijo.size();
+        }
+        std::memcpy(salida + escritos, t.sufijo.data() + desde, t.sufijo.size() - desde);
+        return escritos + t.sufijo.size() - desde;
+    };
+
+    destino.n = n;
+    destino.tamPrefijo = 0;
+    if (n == 0) {
+        destino.bytes.clear();
+        return;
+    }
+
+    // Las claves están ordenadas: el prefijo común de la primera y la última es el de todas
+    const Trozo& primera = claves[0];
+    const Trozo& ultima = claves[n - 1];
+    std::size_t limite = std::min(longitud(primera), longitud(ultima));
+    std::size_t prefijo = 0;
+    while (prefijo < limite && letra(primera, prefijo) == letra(ultima, prefijo)) ++prefijo;
+
+    std::size_t total = prefijo;
+    for (int i = 0; i < n; ++i) total += longitud(claves[i]) - prefijo;
+    destino.bytes.resize(total);
+
+    char* salida = destino.bytes.data();
+    std::size_t escrito = 0;
+    for (std::size_t k = 0; k < prefijo; ++k) salida[escrito++] = letra(primera, k);
+    for (int i = 0; i < n; ++i) {
+        escrito += copiar(claves[i], prefijo, salida + escrito);
+        destino.fin[i] = static_cast<std::uint32_t>(escrito - prefijo);
+    }
+    destino.tamPrefijo = static_cast<std::uint32_t>(prefijo);
+}
+
+/**
+ * @brief Copia una codificación al área del nodo, agrandándola solo si no alcanza.
+ * @param nodo Nodo destino.
+ * @param origen Codificación a copiar.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::Asignar(Nodo* nodo, const Codificado& origen) {
+    std::size_t tam = origen.bytes.size();
+    if (tam > nodo->capacidad) {
+        std::uint32_t capacidad = static_cast<std::uint32_t>(tam + tam / 2);
+        char* area = new char[capacidad];
+        delete[] nodo->area;
+        nodo->area = area;
+        nodo->capacidad = capacidad;
+    }
+    if (tam > 0) std::memcpy(nodo->area, origen.bytes.data(), tam);
+    nodo->tamPrefijo = origen.tamPrefijo;
+    for (int i = 0; i < origen.n; ++i) {
+        nodo->fin[i] = origen.fin[i];
+    }
+    nodo->elemNodo = origen.n;
+}
+
+/**
+ * @brief Inserta una cadena con un único descenso desde la raíz.
+ * @param valor Cadena a insertar.
+ * @return true si se insertó, false si ya estaba en el árbol.
+ */
+template <int grado, typename Desborde>
+bool StarBTreeCadenas<grado, Desborde>::Insertar(std::string_view valor) {
+    if (raiz == nullptr) raiz = new Nodo(true);
+    if (!Agregar(valor, raiz)) return false;
+
+    // La raíz no tiene hermanos: si se llena, se divide y el árbol crece
+    if (raiz->elemNodo == grado) DividirRaiz();
+    return true;
+}
+
+/**
+ * @brief Inserta recursivamente una cadena en el subárbol dado.
+ * @param valor Cadena a insertar.
+ * @param subraiz Raíz del subárbol.
+ * @return true si se insertó, false si la cadena ya existía.
+ */
+template <int grado, typename Desborde>
+bool StarBTreeCadenas<grado, Desborde>::Agregar(std::string_view valor, Nodo* subraiz) {
+    bool encontrado;
+    int i = Posicion(subraiz, valor, encontrado);
+    if (encontrado) return false;
+
+    if (subraiz->hoja) {
+        Trozo claves[grado + 1];
+        int n = 0;
+        for (int j = 0; j < i; ++j) claves[n++] = Clave(subraiz, j);
+        claves[n++] = Trozo{std::string_view(), valor};
+        for (int j = i; j < subraiz->elemNodo; ++j) claves[n++] = Clave(subraiz, j);
+
+        temporal.resize(1);
+        Codificar(claves, n, temporal[0]);
+        Asignar(subraiz, temporal[0]);
+        cantElem++;
+        return true;
+    }
+
+    Nodo* hijo = subraiz->hijo[i];
+    if (!Agregar(valor, hijo)) return false;
+
+    // Tras bajar, si ese hijo se llenó, reequilibrar
+    if (hijo->elemNodo == grado) {
+        OrdenarHijo(subraiz, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Hace lugar en un hijo desbordado según la política de desborde.
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo desbordado.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::OrdenarHijo(Nodo* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(
+        indiceHijo, padre->elemNodo, grado, [padre](int i) { return padre->hijo[i]->elemNodo; });
+    Reorganizacion::Tramo tramo = Reorganizacion::Afectados(plan, indiceHijo);
+    Repartir(padre, tramo.desde, tramo.cuantos, tramo.nuevos);
+}
+
+/**
+ * @brief Elimina una cadena del árbol.
+ * @param valor Cadena a eliminar.
+ * @return true si la cadena existía y se eliminó, false en caso contrario.
+ */
+template <int grado, typename Desborde>
+bool StarBTreeCadenas<grado, Desborde>::Eliminar(std::string_view valor) {
+    if (raiz == nullptr || !Eliminar(valor, raiz)) return false;
+
+    // Si la raíz quedó sin claves, el árbol pierde un nivel
+    if (raiz->elemNodo == 0) {
+        Nodo* vieja = raiz;
+        raiz = vieja->hoja ? nullptr : vieja->hijo[0];
+        delete[] vieja->area;
+        delete vieja;
+    }
+    return true;
+}
+
+/**
+ * @brief Elimina recursivamente una cadena del subárbol dado.
+ *
+ * Una clave de un nodo interno se reemplaza por su predecesor, que se elimina de la hoja
+ * correspondiente. Al regresar, si el hijo visitado quedó por debajo del mínimo, se corrige.
+ *
+ * @param valor Cadena a eliminar.
+ * @param subraiz Raíz del subárbol.
+ * @return true si se eliminó, false si la cadena no existía.
+ */
+template <int grado, typename Desborde>
+bool StarBTreeCadenas<grado, Desborde>::Eliminar(std::string_view valor, Nodo* subraiz) {
+    bool encontrado;
+    int i = Posicion(subraiz, valor, encontrado);
+
+    if (subraiz->hoja) {
+        if (!encontrado) return false;
+
+        Trozo claves[grado];
+        int n = 0;
+        for (int j = 0; j < subraiz->elemNodo; ++j) {
+            if (j != i) claves[n++] = Clave(subraiz, j);
+        }
+        temporal.resize(1);
+        Codificar(claves, n, temporal[0]);
+        Asignar(subraiz, temporal[0]);
+        cantElem--;
+        return true;
+    }
+
+    Nodo* hijo = subraiz->hijo[i];
+    if (encontrado) {
+        // Reemplazar por el predecesor (máximo del subárbol izquierdo); se copia porque
+        // recodificar este nodo y la hoja invalida las vistas
+        const Nodo* pred = hijo;
+        while (!pred->hoja) pred = pred->hijo[pred->elemNodo];
+        Trozo ultima = Clave(pred, pred->elemNodo - 1);
+        std::string predecesor(ultima.prefijo);
+        predecesor.append(ultima.sufijo);
+
+        Trozo claves[grado];
+        for (int j = 0; j < subraiz->elemNodo; ++j) claves[j] = Clave(subraiz, j);
+        claves[i] = Trozo{std::string_view(), predecesor};
+        temporal.resize(1);
+        Codificar(claves, subraiz->elemNodo, temporal[0]);
+        Asignar(subraiz, temporal[0]);
+
+        Eliminar(predecesor, hijo);
+    } else if (!Eliminar(valor, hijo)) {
+        return false;
+    }
+
+    if (hijo->elemNodo < Reorganizacion::MinClaves(grado)) {
+        CorregirSubflujo(subraiz, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Corrige un hijo que quedó con menos claves que el mínimo (ver Reorganizacion::Subflujo).
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo con subflujo.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::CorregirSubflujo(Nodo* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Subflujo(
+        indiceHijo, padre->elemNodo, grado, [padre](int i) { return padre->hijo[i]->elemNodo; });
+    Reorganizacion::Tramo tramo = Reorganizacion::Afectados(plan, indiceHijo);
+    if (tramo.cuantos > 0) Repartir(padre, tramo.desde, tramo.cuantos, tramo.nuevos);
+}
+
+/**
+ * @brief Reparte las claves de hijos consecutivos y sus separadoras en otra cantidad de hijos.
+ *
+ * Cada reorganización es un caso de esta: parejar con un vecino o a lo largo de una cascada
+ * (nuevos == cuantos), dividir (nuevos == cuantos + 1) y fusionar (nuevos == cuantos - 1).
+ * Como cada nodo tocado se recodifica entero, parejar todo el tramo de una cascada cuesta
+ * lo mismo que rotar una clave por cada intermedio.
+ *
+ * @param padre Nodo padre.
+ * @param desde Primer hijo del tramo.
+ * @param cuantos Hijos del tramo.
+ * @param nuevos Hijos que quedan en su lugar (reparto de Reorganizacion::Parte).
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::Repartir(Nodo* padre, int desde, int cuantos, int nuevos) {
+    bool hoja = padre->hijo[desde]->hoja;
+    trozos.clear();
+    hijos.clear();
+    for (int k = 0; k < cuantos; ++k) {
+        const Nodo* nodo = padre->hijo[desde + k];
+        for (int i = 0; i < nodo->elemNodo; ++i) trozos.push_back(Clave(nodo, i));
+        if (k < cuantos - 1) trozos.push_back(Clave(padre, desde + k));
+        if (!hoja) {
+            for (int i = 0; i <= nodo->elemNodo; ++i) hijos.push_back(nodo->hijo[i]);
+        }
+    }
+    int resto = static_cast<int>(trozos.size()) - (nuevos - 1);
+
+    // Codificar los hijos y el padre antes de asignar: las vistas apuntan a sus áreas
+    Trozo delPadre[grado + 1];
+    int nP = 0;
+    for (int i = 0; i < desde; ++i) delPadre[nP++] = Clave(padre, i);
+
+    temporal.resize(nuevos + 1);
+    int clavesHijo[grado + 2];
+    int idx = 0;
+    for (int k = 0; k < nuevos; ++k) {
+        clavesHijo[k] = Reorganizacion::Parte(resto, nuevos, k);
+        Codificar(trozos.data() + idx, clavesHijo[k], temporal[k]);
+        idx += clavesHijo[k];
+        if (k < nuevos - 1) delPadre[nP++] = trozos[idx++];
+    }
+    for (int i = desde + cuantos - 1; i < padre->elemNodo; ++i) delPadre[nP++] = Clave(padre, i);
+    Codificar(delPadre, nP, temporal[nuevos]);
+
+    // Se reusan los nodos del tramo; los que faltan se crean y los que sobran se liberan
+    Nodo* nodos[grado + 2];
+    for (int k = 0; k < nuevos; ++k) {
+        nodos[k] = (k < cuantos) ? padre->hijo[desde + k] : new Nodo(hoja);
+        Asignar(nodos[k], temporal[k]);
+    }
+    for (int k = nuevos; k < cuantos; ++k) {
+        delete[] padre->hijo[desde + k]->area;
+        delete padre->hijo[desde + k];
+    }
+
+    if (!hoja) {
+        idx = 0;
+        for (int k = 0; k < nuevos; ++k) {
+            for (int i = 0; i <= grado; ++i) nodos[k]->hijo[i] = (i <= clavesHijo[k]) ? hijos[idx++] : nullptr;
+        }
+    }
+
+    // Hijos del padre: los de antes del tramo, los nuevos y los de después
+    Nodo* hijosPadre[grado + 2];
+    int nH = 0;
+    for (int i = 0; i < desde; ++i) hijosPadre[nH++] = padre->hijo[i];
+    for (int k = 0; k < nuevos; ++k) hijosPadre[nH++] = nodos[k];
+    for (int i = desde + cuantos; i <= padre->elemNodo; ++i) hijosPadre[nH++] = padre->hijo[i];
+    for (int i = 0; i <= grado; ++i) padre->hijo[i] = (i < nH) ? hijosPadre[i] : nullptr;
+    Asignar(padre, temporal[nuevos]);
+}
+
+/**
+ * @brief Divide la raíz desbordada en dos nodos bajo una raíz nueva.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::DividirRaiz() {
+    Nodo* nueva = new Nodo(false);
+    nueva->hijo[0] = raiz;
+    raiz = nueva;
+    Repartir(nueva, 0, 1, 2);
+}
+
+/**
+ * @brief Busca una cadena bajando desde la raíz.
+ * @param valor Cadena a buscar.
+ * @return true si la cadena se encuentra en el árbol, false en caso contrario.
+ */
+template <int grado, typename Desborde>
+bool StarBTreeCadenas<grado, Desborde>::Buscar(std::string_view valor) const {
+    const Nodo* nodo = raiz;
+    while (nodo != nullptr) {
+        bool encontrado;
+        int i = Posicion(nodo, valor, encontrado);
+        if (encontrado) return true;
+        if (nodo->hoja) return false;
+        nodo = nodo->hijo[i];
+    }
+    return false;
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos.
+ * @return Número de elementos.
+ */
+template <int grado, typename Desborde>
+int StarBTreeCadenas<grado, Desborde>::CantElem() const {
+    return cantElem;
+}
+
+/**
+ * @brief Visita en orden las cadenas en [desde, hasta].
+ * @param desde Límite inferior (inclusivo).
+ * @param hasta Límite superior (inclusivo).
+ * @param fn Función a aplicar a cada clave reconstruida; si devuelve bool, false detiene el recorrido.
+ */
+template <int grado, typename Desborde>
+template <typename Funcion>
+void StarBTreeCadenas<grado, Desborde>::RecorrerRango(std::string_view desde, std::string_view hasta, Funcion fn) const {
+    if (raiz == nullptr || hasta < desde) return;
+    std::string clave; // Se reutiliza para todas las claves visitadas
+    RecorrerRango(raiz, desde, hasta, fn, clave);
+}
+
+/**
+ * @brief Recorre recursivamente un subárbol dentro del rango.
+ * @return false si el recorrido terminó (se pasó de hasta o fn pidió detenerse).
+ */
+template <int grado, typename Desborde>
+template <typename Funcion>
+bool StarBTreeCadenas<grado, Desborde>::RecorrerRango(const Nodo* nodo, std::string_view desde, std::string_view hasta,
+                                            Funcion& fn, std::string& clave) const {
+    bool encontrado;
+    int i = Posicion(nodo, desde, encontrado);
+
+    for (; i < nodo->elemNodo; ++i) {
+        if (!nodo->hoja && !RecorrerRango(nodo->hijo[i], desde, hasta, fn, clave)) return false;
+
+        Trozo actual = Clave(nodo, i);
+        if (Comparar(hasta, actual) < 0) return false;
+        clave.assign(actual.prefijo.data(), actual.prefijo.size());
+        clave.append(actual.sufijo.data(), actual.sufijo.size());
+
+        if constexpr (std::is_same<decltype(fn(clave)), bool>::value) {
+            if (!fn(static_cast<const std::string&>(clave))) return false;
+        } else {
+            fn(static_cast<const std::string&>(clave));
+        }
+    }
+    return nodo->hoja || RecorrerRango(nodo->hijo[nodo->elemNodo], desde, hasta, fn, clave);
+}
+
+/**
+ * @brief Vacía el árbol y libera toda su memoria.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::Vaciar() {
+    Vaciar(raiz);
+    raiz = nullptr;
+    cantElem = 0;
+}
+
+/**
+ * @brief Libera recursivamente un subárbol.
+ * @param nodo Raíz del subárbol.
+ */
+template <int grado, typename Desborde>
+void StarBTreeCadenas<grado, Desborde>::Vaciar(Nodo* nodo) {
+    if (nodo == nullptr) return;
+    if (!nodo->hoja) {
+        for (int i = 0; i <= nodo->elemNodo; ++i) Vaciar(nodo->hijo[i]);
+    }
+    delete[] nodo->area;
+    delete nodo;
+}
+
+/**
+ * @brief Devuelve los bytes reservados para las áreas de claves de todos los nodos.
+ * @return Suma de las capacidades de las áreas.
+ */
+template <int grado, typename Desborde>
+std::size_t StarBTreeCadenas<grado, Desborde>::BytesClaves() const {
+    return BytesClaves(raiz);
+}
+
+/**
+ * @brief Suma recursivamente las capacidades de las áreas de un subárbol.
+ */
+template <int grado, typename Desborde>
+std::size_t StarBTreeCadenas<grado, Desborde>::BytesClaves(const Nodo* nodo) const {
+    if (nodo == nullptr) return 0;
+    std::size_t total = nodo->capacidad;
+    if (!nodo->hoja) {
+        for (int i = 0; i <= nodo->elemNodo; ++i) total += BytesClaves(nodo->hijo[i]);
+    }
+    return total;
+}
@@ -0,0 +1,529 @@
+#include <thread>
+#include "../Headers/StarBTreeConcurrente.hpp"
+
+/**
+ * @file StarBTreeConcurrente.tpp
+ * @brief Implementación del Árbol B* concurrente con acoplamiento optimista de candados.
+ * @details Protocolo de versiones: un escritor bloquea un nodo cambiando su versión con
+ * una comparación e intercambio a partir de la versión que leyó, de modo que el bloqueo
+ * falla si el nodo cambió desde entonces. Un lector valida cada nodo antes de confiar en
+ * lo leído y valida al padre después de leer la versión del hijo (acoplamiento).
+ * @tparam Type Tipo de los elementos (trivialmente copiable).
+ * @tparam grado Grado del árbol (número máximo de claves por nodo más uno).
+ * @tparam Compare Orden estricto de las claves (std::less<Type> por defecto).
+ * @tparam Desborde Política para los hijos llenos (ver PoliticaDesborde).
+ */
+
+/**
+ * @brief Constructor por defecto: la raíz es una hoja vacía y nunca es nula.
+ * @param comparar Orden de las claves.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+StarBTreeConcurrente<Type, grado, Compare, Desborde>::StarBTreeConcurrente(const Compare& comparar)
+    : raiz(new Nodo(true)), cantElem(0), comparar(comparar) {}
+
+/**
+ * @brief Destructor; ningún otro hilo puede estar usando el árbol.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+StarBTreeConcurrente<Type, grado, Compare, Desborde>::~StarBTreeConcurrente() {
+    Vaciar(raiz.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Inserta un valor; puede llamarse desde varios hilos a la vez.
+ * @param valor Valor a insertar.
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreeConcurrente<Type, grado, Compare, Desborde>::Insertar(const Type& valor) {
+    Intento resultado;
+    while ((resultado = IntentarInsertar(valor)) == Intento::Reintentar) {}
+    return resultado == Intento::Exito;
+}
+
+/**
+ * @brief Busca un valor sin tomar candados; puede llamarse desde varios hilos a la vez.
+ * @param valor Valor a buscar.
+ * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreeConcurrente<Type, grado, Compare, Desborde>::Buscar(const Type& valor) const {
+    Intento resultado;
+    while ((resultado = IntentarBuscar(valor)) == Intento::Reintentar) {}
+    return resultado == Intento::Exito;
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos.
+ * @return Número de elementos; con escritores activos es una instantánea aproximada.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+int StarBTreeConcurrente<Type, grado, Compare, Desborde>::CantElem() const {
+    return cantElem.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Elimina todos los elementos; ningún otro hilo puede estar usando el árbol.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::Vaciar() {
+    Vaciar(raiz.load(std::memory_order_relaxed));
+    raiz.store(new Nodo(true), std::memory_order_release);
+    cantElem.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Libera todos los nodos del subárbol de forma recursiva.
+ * @param nodo Nodo raíz del subárbol a liberar.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::Vaciar(Nodo* nodo) {
+    if (!nodo->hoja) {
+        for (int i = 0; i <= Cantidad(nodo); ++i) {
+            Vaciar(Hijo(nodo, i));
+        }
+    }
+    delete nodo;
+}
+
+/**
+ * @brief Lee la versión de un nodo, esperando mientras esté bloqueado.
+ * @param nodo Nodo a leer.
+ * @return Versión estable (sin el bit de bloqueo).
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+std::uint64_t StarBTreeConcurrente<Type, grado, Compare, Desborde>::LeerVersion(const Nodo* nodo) {
+    std::uint64_t version = nodo->version.load(std::memory_order_acquire);
+    for (int vueltas = 1; version & bloqueado; ++vueltas) {
+        if (vueltas % 64 == 0) std::this_thread::yield();
+        version = nodo->version.load(std::memory_order_acquire);
+    }
+    return version;
+}
+
+/**
+ * @brief Verifica que el nodo no cambió desde que se leyó la versión.
+ * @return true si lo leído del nodo entre ambas lecturas es consistente.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreeConcurrente<Type, grado, Compare, Desborde>::Validar(const Nodo* nodo, std::uint64_t version) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return nodo->version.load(std::memory_order_relaxed) == version;
+}
+
+/**
+ * @brief Bloquea el nodo solo si sigue en la versión leída.
+ * @return true si se bloqueó; false si el nodo cambió o está bloqueado.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreeConcurrente<Type, grado, Compare, Desborde>::Bloquear(Nodo* nodo, std::uint64_t version) {
+    std::uint64_t esperado = version;
+    if (!nodo->version.compare_exchange_strong(esperado, version + bloqueado,
+                                               std::memory_order_acquire, std::memory_order_relaxed)) {
+        return false;
+    }
+    // Las escrituras siguientes no pueden verse antes que el bit de bloqueo
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Bloquea un nodo esperando a que lo suelte quien lo tenga.
+ *
+ * Solo se usa con los hermanos de un hijo cuyo padre ya está bloqueado: quien tenga el
+ * hermano no espera por ningún nodo de este nivel ni de los superiores.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::BloquearEsperando(Nodo* nodo) {
+    while (!Bloquear(nodo, LeerVersion(nodo))) {}
+}
+
+/**
+ * @brief Desbloquea el nodo y publica una versión nueva.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::Desbloquear(Nodo* nodo) {
+    nodo->version.fetch_add(bloqueado, std::memory_order_release);
+}
+
+/**
+ * @brief Un descenso optimista desde la raíz.
+ * @return Exito o Fallo si la respuesta es válida; Reintentar si algún nodo cambió durante la lectura.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+typename StarBTreeConcurrente<Type, grado, Compare, Desborde>::Intento
+StarBTreeConcurrente<Type, grado, Compare, Desborde>::IntentarBuscar(const Type& valor) const {
+    const Nodo* nodo = raiz.load(std::memory_order_acquire);
+    std::uint64_t version = LeerVersion(nodo);
+    // Una división de la raíz cambia la raíz antes de desbloquear la anterior
+    if (nodo != raiz.load(std::memory_order_acquire)) return Intento::Reintentar;
+
+    while (true) {
+        int n = Cantidad(nodo);
+        if (n < 0 || n > lleno) return Intento::Reintentar;
+
+        int i = Busqueda::Posicion(nodo->claves, n, valor, comparar);
+        if (i < n && !comparar(valor, nodo->claves[i])) {
+            return Validar(nodo, version) ? Intento::Exito : Intento::Reintentar;
+        }
+        if (nodo->hoja) {
+            return Validar(nodo, version) ? Intento::Fallo : Intento::Reintentar;
+        }
+
+        const Nodo* hijo = Hijo(nodo, i);
+        if (hijo == nullptr) return Intento::Reintentar;
+        std::uint64_t versionHijo = LeerVersion(hijo);
+        if (!Validar(nodo, version)) return Intento::Reintentar;
+
+        nodo = hijo;
+        version = versionHijo;
+    }
+}
+
+/**
+ * @brief Un intento de inserción.
+ *
+ * Baja de forma optimista. Si el hijo por el que hay que bajar está lleno, bloquea al
+ * padre y al hijo, lo reorganiza con sus hermanos y reinicia. Al llegar a la hoja la
+ * bloquea e inserta. Cualquier cambio concurrente detectado provoca un reintento.
+ *
+ * @return Exito si se insertó, Fallo si ya existía, Reintentar en otro caso.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+typename StarBTreeConcurrente<Type, grado, Compare, Desborde>::Intento
+StarBTreeConcurrente<Type, grado, Compare, Desborde>::IntentarInsertar(const Type& valor) {
+    Nodo* nodo = raiz.load(std::memory_order_acquire);
+    std::uint64_t version = LeerVersion(nodo);
+    if (nodo != raiz.load(std::memory_order_acquire)) return Intento::Reintentar;
+
+    // La raíz no tiene hermanos: si está llena, se divide antes de bajar
+    if (Cantidad(nodo) == lleno) {
+        if (!Bloquear(nodo, version)) return Intento::Reintentar;
+        DividirRaiz(nodo);
+        Desbloquear(nodo);
+        return Intento::Reintentar;
+    }
+
+    while (true) {
+        int n = Cantidad(nodo);
+        if (n < 0 || n >= lleno) return Intento::Reintentar;
+
+        int i = Busqueda::Posicion(nodo->claves, n, valor, comparar);
+        if (i < n && !comparar(valor, nodo->claves[i])) {
+            return Validar(nodo, version) ? Intento::Fallo : Intento::Reintentar;
+        }
+
+        if (nodo->hoja) {
+            // El bloqueo solo se logra si nada cambió desde la lectura: n e i siguen valiendo
+            if (!Bloquear(nodo, version)) return Intento::Reintentar;
+            for (int j = n; j > i; --j) {
+                nodo->claves[j] = nodo->claves[j - 1];
+            }
+            nodo->claves[i] = valor;
+            FijarCantidad(nodo, n + 1);
+            Desbloquear(nodo);
+            cantElem.fetch_add(1, std::memory_order_relaxed);
+            return Intento::Exito;
+        }
+
+        Nodo* hijo = Hijo(nodo, i);
+        if (hijo == nullptr) return Intento::Reintentar;
+        std::uint64_t versionHijo = LeerVersion(hijo);
+        if (!Validar(nodo, version)) return Intento::Reintentar;
+
+        if (Cantidad(hijo) == lleno) {
+            // nodo no está lleno (se comprobó al bajar a él), así que admite una división triple
+            if (!Bloquear(nodo, version)) return Intento::Reintentar;
+            if (!Bloquear(hijo, versionHijo)) {
+                Desbloquear(nodo);
+                return Intento::Reintentar;
+            }
+            OrdenarHijo(nodo, i);
+            Desbloquear(hijo);
+            Desbloquear(nodo);
+            return Intento::Reintentar;
+        }
+
+        nodo = hijo;
+        version = versionHijo;
+    }
+}
+
+/**
+ * @brief Hace lugar en un hijo lleno según el plan de Reorganizacion::Desbordar.
+ *
+ * El padre y el hijo llegan bloqueados. Cada hermano que el plan consulta se bloquea antes
+ * de leer su cantidad de claves y se suelta al final; como solo se bloquean hermanos con el
+ * padre ya bloqueado, nadie más espera por ellos en ese momento. Los nodos nunca pasan de
+ * lleno claves, así que para Desbordar la capacidad del nivel es lleno.
+ *
+ * @param padre Nodo padre (no lleno).
+ * @param indiceHijo Índice del hijo lleno.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::OrdenarHijo(Nodo* padre, int indiceHijo) {
+    // Las divisiones corren los índices del padre: se anotan los nodos, no los índices
+    bool consultado[grado + 1] = {};
+    Nodo* bloqueados[grado + 1];
+    int cuantos = 0;
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(indiceHijo, Cantidad(padre), lleno, [&](int i) {
+        Nodo* hermano = Hijo(padre, i);
+        if (i != indiceHijo && !consultado[i]) {
+            BloquearEsperando(hermano);
+            consultado[i] = true;
+            bloqueados[cuantos++] = hermano;
+        }
+        return Cantidad(hermano);
+    });
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada:
+            // Desbordar consultó (y bloqueó) a todos los hermanos entre el hijo y el elegido
+            if (plan.indice < indiceHijo) {
+                for (int j = plan.indice; j < indiceHijo; ++j) Rotar(padre, j, false);
+            } else {
+                for (int j = plan.indice; j > indiceHijo; --j) Rotar(padre, j - 1, true);
+            }
+            break;
+        case Reorganizacion::Accion::Nivelar: Repartir(padre, plan.indice); break;
+        case Reorganizacion::Accion::DividirTriple: DividirTriple(padre, plan.indice); break;
+        default: DividirDoble(padre, indiceHijo); break;
+    }
+
+    for (int k = 0; k < cuantos; ++k) Desbloquear(bloqueados[k]);
+}
+
+/**
+ * @brief Pasa una clave entre hijo[indice] e hijo[indice + 1] a través de la separadora.
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ * @param haciaDerecha true para pasar la última clave del izquierdo al comienzo del
+ * derecho, false para pasar la primera del derecho al final del izquierdo.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::Rotar(Nodo* padre, int indice, bool haciaDerecha) {
+    Nodo* izquierdo = Hijo(padre, indice);
+    Nodo* derecho = Hijo(padre, indice + 1);
+    bool hoja = izquierdo->hoja;
+    int nI = Cantidad(izquierdo);
+    int nD = Cantidad(derecho);
+
+    if (haciaDerecha) {
+        for (int j = nD; j > 0; --j) derecho->claves[j] = derecho->claves[j - 1];
+        derecho->claves[0] = padre->claves[indice];
+        padre->claves[indice] = izquierdo->claves[nI - 1];
+        if (!hoja) {
+            for (int j = nD + 1; j > 0; --j) FijarHijo(derecho, j, Hijo(derecho, j - 1));
+            FijarHijo(derecho, 0, Hijo(izquierdo, nI));
+            FijarHijo(izquierdo, nI, nullptr);
+        }
+        FijarCantidad(izquierdo, nI - 1);
+        FijarCantidad(derecho, nD + 1);
+    } else {
+        izquierdo->claves[nI] = padre->claves[indice];
+        padre->claves[indice] = derecho->claves[0];
+        for (int j = 0; j < nD - 1; ++j) derecho->claves[j] = derecho->claves[j + 1];
+        if (!hoja) {
+            FijarHijo(izquierdo, nI + 1, Hijo(derecho, 0));
+            for (int j = 0; j < nD; ++j) FijarHijo(derecho, j, Hijo(derecho, j + 1));
+            FijarHijo(derecho, nD, nullptr);
+        }
+        FijarCantidad(izquierdo, nI + 1);
+        FijarCantidad(derecho, nD - 1);
+    }
+}
+
+/**
+ * @brief Reparte en partes iguales las claves de hijo[indice] e hijo[indice + 1].
+ * @param padre Nodo padre.
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::Repartir(Nodo* padre, int indice) {
+    Nodo* izquierdo = Hijo(padre, indice);
+    Nodo* derecho = Hijo(padre, indice + 1);
+    bool hoja = izquierdo->hoja;
+    int nI = Cantidad(izquierdo);
+    int nD = Cantidad(derecho);
+
+    Type claves[2 * grado];
+    Nodo* hijos[2 * grado + 2];
+    int total = 0;
+    int totalHijos = 0;
+
+    for (int i = 0; i < nI; ++i) claves[total++] = izquierdo->claves[i];
+    claves[total++] = padre->claves[indice];
+    for (int i = 0; i < nD; ++i) claves[total++] = derecho->claves[i];
+    if (!hoja) {
+        for (int i = 0; i <= nI; ++i) hijos[totalHijos++] = Hijo(izquierdo, i);
+        for (int i = 0; i <= nD; ++i) hijos[totalHijos++] = Hijo(derecho, i);
+    }
+
+    // La separadora queda en el padre; el resto se reparte por mitades
+    int clavesI = Reorganizacion::Mitad(total - 1);
+    int clavesD = total - 1 - clavesI;
+
+    int idx = 0;
+    for (int i = 0; i < clavesI; ++i) izquierdo->claves[i] = claves[idx++];
+    padre->claves[indice] = claves[idx++];
+    for (int i = 0; i < clavesD; ++i) derecho->claves[i] = claves[idx++];
+
+    if (!hoja) {
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            FijarHijo(izquierdo, i, (i <= clavesI) ? hijos[idx++] : nullptr);
+        for (int i = 0; i <= grado; ++i)
+            FijarHijo(derecho, i, (i <= clavesD) ? hijos[idx++] : nullptr);
+    }
+
+    FijarCantidad(izquierdo, clavesI);
+    FijarCantidad(derecho, clavesD);
+}
+
+/**
+ * @brief Divide hijo[indice] e hijo[indice + 1] en tres nodos; el padre gana una clave.
+ *
+ * Ambos hermanos se reutilizan y solo se crea el del medio, que se publica en el padre
+ * ya inicializado.
+ *
+ * @param padre Nodo padre (no lleno).
+ * @param indice Índice del primero de los dos hermanos.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::DividirTriple(Nodo* padre, int indice) {
+    Nodo* A = Hijo(padre, indice);
+    Nodo* C = Hijo(padre, indice + 1);
+    bool hoja = A->hoja;
+    Nodo* B = new Nodo(hoja);
+    int nA = Cantidad(A);
+    int nC = Cantidad(C);
+
+    Type claves[2 * grado];
+    Nodo* hijos[2 * grado + 2];
+    int total = 0;
+    int totalHijos = 0;
+
+    for (int i = 0; i < nA; ++i) claves[total++] = A->claves[i];
+    claves[total++] = padre->claves[indice];
+    for (int i = 0; i < nC; ++i) claves[total++] = C->claves[i];
+    if (!hoja) {
+        for (int i = 0; i <= nA; ++i) hijos[totalHijos++] = Hijo(A, i);
+        for (int i = 0; i <= nC; ++i) hijos[totalHijos++] = Hijo(C, i);
+    }
+
+    // Repartir las claves restantes (sin las dos separadoras) en tres tercios
+    Reorganizacion::Tercios tercios = Reorganizacion::Triple(total - 2);
+    int clavesA = tercios.a;
+    int clavesB = tercios.b;
+    int clavesC = tercios.c;
+
+    int idx = 0;
+    for (int i = 0; i < clavesA; ++i) A->claves[i] = claves[idx++];
+    Type sepAB = claves[idx++];
+    for (int i = 0; i < clavesB; ++i) B->claves[i] = claves[idx++];
+    Type sepBC = claves[idx++];
+    for (int i = 0; i < clavesC; ++i) C->claves[i] = claves[idx++];
+
+    if (!hoja) {
+        idx = 0;
+        for (int i = 0; i <= grado; ++i)
+            FijarHijo(A, i, (i <= clavesA) ? hijos[idx++] : nullptr);
+        for (int i = 0; i <= clavesB; ++i)
+            FijarHijo(B, i, hijos[idx++]);
+        for (int i = 0; i <= grado; ++i)
+            FijarHijo(C, i, (i <= clavesC) ? hijos[idx++] : nullptr);
+    }
+    FijarCantidad(A, clavesA);
+    FijarCantidad(B, clavesB);
+    FijarCantidad(C, clavesC);
+
+    // Desplazar claves y punteros en padre para abrir lugar a B
+    int n = Cantidad(padre);
+    for (int i = n; i > indice + 1; --i) {
+        padre->claves[i] = padre->claves[i - 1];
+        FijarHijo(padre, i + 1, Hijo(padre, i));
+    }
+    padre->claves[indice] = sepAB;
+    padre->claves[indice + 1] = sepBC;
+    FijarHijo(padre, indice + 1, B);
+    FijarHijo(padre, indice + 2, C);
+    FijarCantidad(padre, n + 1);
+}
+
+/**
+ * @brief Parte hijo[indiceHijo] (lleno y bloqueado) en dos; la clave del medio sube al padre.
+ *
+ * El hijo se reutiliza como mitad izquierda y la derecha se publica en el padre ya
+ * inicializada.
+ *
+ * @param padre Nodo padre (no lleno).
+ * @param indiceHijo Índice del hijo lleno.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::DividirDoble(Nodo* padre, int indiceHijo) {
+    Nodo* hijo = Hijo(padre, indiceHijo);
+    Nodo* derecho = PartirMitad(hijo);
+
+    int n = Cantidad(padre);
+    for (int i = n; i > indiceHijo; --i) {
+        padre->claves[i] = padre->claves[i - 1];
+        FijarHijo(padre, i + 1, Hijo(padre, i));
+    }
+    padre->claves[indiceHijo] = hijo->claves[Cantidad(hijo)];
+    FijarHijo(padre, indiceHijo + 1, derecho);
+    FijarCantidad(padre, n + 1);
+}
+
+/**
+ * @brief Pasa la mitad derecha de un nodo lleno (bloqueado) a un nodo nuevo.
+ *
+ * El original conserva las Mitad(lleno) claves menores; la clave del medio, que debe subir
+ * como separadora, queda en nodo->claves[Cantidad(nodo)].
+ *
+ * @param nodo Nodo con lleno claves.
+ * @return El nodo nuevo con las claves mayores que la separadora.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+typename StarBTreeConcurrente<Type, grado, Compare, Desborde>::Nodo*
+StarBTreeConcurrente<Type, grado, Compare, Desborde>::PartirMitad(Nodo* nodo) {
+    bool hoja = nodo->hoja;
+    Nodo* derecho = new Nodo(hoja);
+
+    int clavesI = Reorganizacion::Mitad(lleno);
+    int clavesD = lleno - clavesI - 1;
+
+    for (int i = 0; i < clavesD; ++i) {
+        derecho->claves[i] = nodo->claves[clavesI + 1 + i];
+    }
+    if (!hoja) {
+        for (int i = 0; i <= clavesD; ++i) {
+            FijarHijo(derecho, i, Hijo(nodo, clavesI + 1 + i));
+            FijarHijo(nodo, clavesI + 1 + i, nullptr);
+        }
+    }
+    FijarCantidad(derecho, clavesD);
+    FijarCantidad(nodo, clavesI);
+    return derecho;
+}
+
+/**
+ * @brief Divide la raíz llena (ya bloqueada) en dos nodos bajo una nueva raíz.
+ *
+ * La raíz anterior pasa a ser el hijo izquierdo. La nueva raíz se publica antes de que
+ * quien llama desbloquee la anterior, así un lector que validó la raíz vieja reintenta.
+ *
+ * @param vieja Raíz actual, bloqueada.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreeConcurrente<Type, grado, Compare, Desborde>::DividirRaiz(Nodo* vieja) {
+    Nodo* derecho = PartirMitad(vieja);
+
+    Nodo* nueva = new Nodo(false);
+    nueva->claves[0] = vieja->claves[Cantidad(vieja)];
+    FijarHijo(nueva, 0, vieja);
+    FijarHijo(nueva, 1, derecho);
+    FijarCantidad(nueva, 1);
+
+    raiz.store(nueva, std::memory_order_release);
+}
@@ -0,0 +1,168 @@
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+#include "../Headers/StarBTreeDurable.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file StarBTreeDurable.tpp
+ * @brief Implementación del Árbol B* con imagen y bitácora de escritura anticipada.
+ * @tparam Type Tipo de los elementos (trivialmente copiable).
+ * @tparam grado Grado del árbol.
+ * @tparam Compare Orden estricto de las claves (std::less<Type> por defecto).
+ */
+
+/**
+ * @brief Abre el árbol persistido en ruta.img y ruta.wal, o lo crea vacío.
+ * @param ruta Ruta base de los archivos.
+ * @param operacionesPorGrupo Operaciones por confirmación de la bitácora (1 = fsync por operación).
+ * @param intervalo Espera máxima de una operación por su confirmación mientras llegan otras.
+ * @param comparar Orden de las claves.
+ * @throws std::runtime_error Si la imagen o la bitácora existen pero no son válidas.
+ */
+template <typename Type, int grado, typename Compare>
+StarBTreeDurable<Type, grado, Compare>::StarBTreeDurable(const std::string& ruta, int operacionesPorGrupo,
+                                                         std::chrono::milliseconds intervalo, const Compare& comparar)
+    : ruta(ruta), arbol(comparar), bitacora(ruta + ".wal", operacionesPorGrupo, intervalo) {
+    Recuperar();
+}
+
+/**
+ * @brief Inserta un valor; si era nuevo, registra la inserción.
+ *
+ * Si el registro falla, la inserción se deshace: el árbol no contiene nada que la
+ * bitácora no tenga.
+ *
+ * @param valor Valor a insertar.
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ * @throws std::runtime_error Si la bitácora no se puede escribir (el árbol queda como estaba).
+ */
+template <typename Type, int grado, typename Compare>
+bool StarBTreeDurable<Type, grado, Compare>::Insertar(const Type& valor) {
+    if (!arbol.Insertar(valor)) return false;
+    try {
+        bitacora.Registrar(Operacion::Insercion, valor);
+    } catch (...) {
+        arbol.Eliminar(valor);
+        throw;
+    }
+    return true;
+}
+
+/**
+ * @brief Elimina un valor; si existía, registra la eliminación.
+ *
+ * Si el registro falla, el valor se vuelve a insertar.
+ *
+ * @param valor Valor a eliminar.
+ * @return true si el valor existía y se eliminó.
+ * @throws std::runtime_error Si la bitácora no se puede escribir (el árbol queda como estaba).
+ */
+template <typename Type, int grado, typename Compare>
+bool StarBTreeDurable<Type, grado, Compare>::Eliminar(const Type& valor) {
+    if (!arbol.Eliminar(valor)) return false;
+    try {
+        bitacora.Registrar(Operacion::Eliminacion, valor);
+    } catch (...) {
+        arbol.Insertar(valor);
+        throw;
+    }
+    return true;
+}
+
+/**
+ * @brief Busca un valor en el árbol en memoria.
+ */
+template <typename Type, int grado, typename Compare>
+bool StarBTreeDurable<Type, grado, Compare>::Buscar(const Type& valor) const {
+    return arbol.Buscar(valor);
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos.
+ */
+template <typename Type, int grado, typename Compare>
+int StarBTreeDurable<Type, grado, Compare>::CantElem() const {
+    return arbol.CantElem();
+}
+
+/**
+ * @brief Acceso de solo lectura al árbol en memoria.
+ */
+template <typename Type, int grado, typename Compare>
+const typename StarBTreeDurable<Type, grado, Compare>::Arbol& StarBTreeDurable<Type, grado, Compare>::Contenido() const {
+    return arbol;
+}
+
+/**
+ * @brief Lleva al disco las operaciones registradas que aún esperan su grupo.
+ */
+template <typename Type, int grado, typename Compare>
+void StarBTreeDurable<Type, grado, Compare>::Confirmar() {
+    bitacora.Confirmar();
+}
+
+/**
+ * @brief Guarda una imagen completa y vacía la bitácora.
+ *
+ * La imagen se escribe a un archivo temporal, se sincroniza y reemplaza a la anterior con
+ * un renombrado; el directorio se sincroniza para que el renombrado llegue al disco, y
+ * recién entonces se trunca la bitácora. Si el proceso cae antes, la bitácora se reproduce
+ * sobre una imagen que ya la contiene (o sobre la anterior), lo que no cambia el resultado.
+ *
+ * @throws std::runtime_error Si la imagen no se puede escribir o sincronizar.
+ */
+template <typename Type, int grado, typename Compare>
+void StarBTreeDurable<Type, grado, Compare>::PuntoControl() {
+    std::string temporal = ruta + ".img.tmp";
+    arbol.Guardar(temporal);
+    Sincronizar(temporal);
+    std::filesystem::rename(temporal, ruta + ".img");
+
+    std::filesystem::path directorio = std::filesystem::path(ruta).parent_path();
+    Sincronizar(directorio.empty() ? std::string(".") : directorio.string());
+    bitacora.Truncar();
+}
+
+/**
+ * @brief Espera a que un archivo o directorio llegue al disco (fsync).
+ * @param destino Ruta del archivo o directorio.
+ * @throws std::runtime_error Si no se puede abrir o sincronizar.
+ */
+template <typename Type, int grado, typename Compare>
+void StarBTreeDurable<Type, grado, Compare>::Sincronizar(const std::string& destino) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = open(destino.c_str(), O_RDONLY);
+    if (fd < 0 || fsync(fd) != 0) {
+        if (fd >= 0) close(fd);
+        throw std::runtime_error("No se pudo sincronizar " + destino);
+    }
+    close(fd);
+#else
+    (void)destino;
+#endif
+}
+
+/**
+ * @brief Carga la última imagen y reproduce encima las operaciones de la bitácora.
+ */
+template <typename Type, int grado, typename Compare>
+void StarBTreeDurable<Type, grado, Compare>::Recuperar() {
+    std::string imagen = ruta + ".img";
+    if (std::filesystem::exists(imagen)) {
+        StarBTreeImagen<Type, Compare> vista(imagen);
+        std::vector<Type> claves;
+        claves.reserve(vista.CantElem());
+        vista.Recorrer([&claves](const Type& valor) { claves.push_back(valor); });
+        arbol.CargarOrdenado(claves.begin(), claves.end());
+    }
+
+    bitacora.Reproducir([this](Operacion operacion, const Type& valor) {
+        if (operacion == Operacion::Insercion) arbol.Insertar(valor);
+        else arbol.Eliminar(valor);
+    });
+}
@@ -0,0 +1,470 @@
+#include <type_traits>
+#include "../Headers/StarBTreeEnteros.hpp"
+
+/**
+ * @file StarBTreeEnteros.tpp
+ * @brief Implementación del Árbol B* de enteros con hojas comprimidas.
+ * @details Las reorganizaciones trabajan sobre arreglos planos: Extraer decodifica una
+ * hoja (o copia las claves de un nodo interno) y Escribir la recodifica con la base y el
+ * ancho que corresponden a sus nuevas claves. Toda reorganización pasa por Repartir.
+ * @tparam Type Tipo entero de las claves.
+ * @tparam grado Grado de los nodos internos (número máximo de claves más uno).
+ * @tparam gradoHoja Grado de las hojas.
+ * @tparam Desborde Política de desborde (ver PoliticaDesborde).
+ */
+
+/**
+ * @brief Constructor por defecto: árbol vacío.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::StarBTreeEnteros() : raiz(nullptr), cantElem(0) {}
+
+/**
+ * @brief Destructor: libera los nodos y los desplazamientos de las hojas.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::~StarBTreeEnteros() {
+    Vaciar();
+}
+
+/**
+ * @brief Copia las claves de un nodo a un arreglo plano.
+ * @param nodo Hoja (se decodifica) o nodo interno.
+ * @param destino Arreglo con espacio para elemNodo claves.
+ * @return Cantidad de claves copiadas.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+int StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Extraer(const Nodo* nodo, Type* destino) {
+    int n = nodo->elemNodo;
+    if (nodo->hoja) {
+        const Hoja* hoja = ComoHoja(nodo);
+        Compresion::Desempaquetar(hoja->base, hoja->ancho, hoja->Datos(), 0, n, destino);
+    } else {
+        const Interno* interno = ComoInterno(nodo);
+        for (int i = 0; i < n; ++i) destino[i] = interno->claves[i];
+    }
+    return n;
+}
+
+/**
+ * @brief Reemplaza las claves de un nodo; las hojas se recodifican con una base y un ancho nuevos.
+ * @param nodo Nodo destino.
+ * @param claves Claves en orden ascendente.
+ * @param n Cantidad de claves (a lo sumo la capacidad del nodo).
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Escribir(Nodo* nodo, const Type* claves, int n) {
+    nodo->elemNodo = n;
+    if (!nodo->hoja) {
+        Interno* interno = ComoInterno(nodo);
+        for (int i = 0; i < n; ++i) interno->claves[i] = claves[i];
+        return;
+    }
+
+    Hoja* hoja = ComoHoja(nodo);
+    int ancho = Compresion::Ancho(claves, n);
+    std::size_t tam = static_cast<std::size_t>(n) * ancho;
+    if (tam <= bytesEnLinea) {
+        if (hoja->capacidad > 0) {
+            delete[] hoja->externos;
+            hoja->capacidad = 0;
+        }
+    } else if (tam > hoja->capacidad || tam * 4 < hoja->capacidad) {
+        // Afuera se agranda con holgura y se achica solo si sobra mucho
+        std::uint32_t capacidad = static_cast<std::uint32_t>(tam + tam / 2);
+        unsigned char* externos = new unsigned char[capacidad];
+        if (hoja->capacidad > 0) delete[] hoja->externos;
+        hoja->externos = externos;
+        hoja->capacidad = capacidad;
+    }
+    hoja->base = n > 0 ? claves[0] : Type();
+    hoja->ancho = ancho;
+    Compresion::Empaquetar(claves, n, ancho, hoja->Datos());
+}
+
+/**
+ * @brief Inserta un valor con un único descenso desde la raíz.
+ * @param valor Valor a insertar.
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Insertar(Type valor) {
+    if (raiz == nullptr) raiz = new Hoja();
+    if (!Agregar(valor, raiz)) return false;
+
+    // La raíz no tiene hermanos: si se llena, se divide y el árbol crece
+    if (raiz->elemNodo == Capacidad(raiz)) DividirRaiz();
+    return true;
+}
+
+/**
+ * @brief Inserta recursivamente un valor en el subárbol dado.
+ * @param valor Valor a insertar.
+ * @param subraiz Raíz del subárbol.
+ * @return true si se insertó, false si el valor ya existía.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Agregar(Type valor, Nodo* subraiz) {
+    if (subraiz->hoja) {
+        Hoja* hoja = ComoHoja(subraiz);
+        int n = hoja->elemNodo;
+        int i = Compresion::Posicion(hoja->base, hoja->ancho, hoja->Datos(), n, valor);
+        if (i < n && Compresion::Leer(hoja->base, hoja->ancho, hoja->Datos(), i) == valor) return false;
+
+        Type claves[gradoHoja + 1];
+        Extraer(hoja, claves);
+        for (int j = n; j > i; --j) claves[j] = claves[j - 1];
+        claves[i] = valor;
+        Escribir(hoja, claves, n + 1);
+        cantElem++;
+        return true;
+    }
+
+    Interno* interno = ComoInterno(subraiz);
+    int i = Busqueda::Posicion(interno->claves, interno->elemNodo, valor);
+    if (i < interno->elemNodo && interno->claves[i] == valor) return false;
+
+    Nodo* hijo = interno->hijo[i];
+    if (!Agregar(valor, hijo)) return false;
+
+    // Tras bajar, si ese hijo se llenó, reequilibrar
+    if (hijo->elemNodo == Capacidad(hijo)) {
+        OrdenarHijo(interno, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Hace lugar en un hijo desbordado según la política de desborde.
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo desbordado.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::OrdenarHijo(Interno* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(
+        indiceHijo, padre->elemNodo, Capacidad(padre->hijo[indiceHijo]),
+        [padre](int i) { return padre->hijo[i]->elemNodo; });
+    Reorganizacion::Tramo tramo = Reorganizacion::Afectados(plan, indiceHijo);
+    Repartir(padre, tramo.desde, tramo.cuantos, tramo.nuevos);
+}
+
+/**
+ * @brief Elimina un valor del árbol.
+ * @param valor Valor a eliminar.
+ * @return true si el valor existía y se eliminó, false en caso contrario.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Eliminar(Type valor) {
+    if (raiz == nullptr || !Eliminar(valor, raiz)) return false;
+
+    // Si la raíz quedó sin claves, el árbol pierde un nivel
+    if (raiz->elemNodo == 0) {
+        Nodo* vieja = raiz;
+        raiz = vieja->hoja ? nullptr : ComoInterno(vieja)->hijo[0];
+        Destruir(vieja);
+    }
+    return true;
+}
+
+/**
+ * @brief Elimina recursivamente un valor del subárbol dado.
+ *
+ * Una clave de un nodo interno se reemplaza por su predecesor, que se elimina de la hoja
+ * correspondiente. Al regresar, si el hijo visitado quedó por debajo del mínimo, se corrige.
+ *
+ * @param valor Valor a eliminar.
+ * @param subraiz Raíz del subárbol.
+ * @return true si se eliminó, false si el valor no existía.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Eliminar(Type valor, Nodo* subraiz) {
+    if (subraiz->hoja) {
+        Hoja* hoja = ComoHoja(subraiz);
+        int n = hoja->elemNodo;
+        int i = Compresion::Posicion(hoja->base, hoja->ancho, hoja->Datos(), n, valor);
+        if (i == n || Compresion::Leer(hoja->base, hoja->ancho, hoja->Datos(), i) != valor) return false;
+
+        Type claves[gradoHoja];
+        Extraer(hoja, claves);
+        for (int j = i; j < n - 1; ++j) claves[j] = claves[j + 1];
+        Escribir(hoja, claves, n - 1);
+        cantElem--;
+        return true;
+    }
+
+    Interno* interno = ComoInterno(subraiz);
+    int i = Busqueda::Posicion(interno->claves, interno->elemNodo, valor);
+    Nodo* hijo = interno->hijo[i];
+    if (i < interno->elemNodo && interno->claves[i] == valor) {
+        // Reemplazar por el predecesor (máximo del subárbol izquierdo)
+        const Nodo* pred = hijo;
+        while (!pred->hoja) pred = ComoInterno(pred)->hijo[pred->elemNodo];
+        const Hoja* hoja = ComoHoja(pred);
+        interno->claves[i] = Compresion::Leer(hoja->base, hoja->ancho, hoja->Datos(), hoja->elemNodo - 1);
+        Eliminar(interno->claves[i], hijo);
+    } else if (!Eliminar(valor, hijo)) {
+        return false;
+    }
+
+    if (hijo->elemNodo < Reorganizacion::MinClaves(Capacidad(hijo))) {
+        CorregirSubflujo(interno, i);
+    }
+    return true;
+}
+
+/**
+ * @brief Corrige un hijo que quedó con menos claves que el mínimo (ver Reorganizacion::Subflujo).
+ * @param padre Nodo padre.
+ * @param indiceHijo Índice del hijo con subflujo.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::CorregirSubflujo(Interno* padre, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Subflujo(
+        indiceHijo, padre->elemNodo, Capacidad(padre->hijo[indiceHijo]),
+        [padre](int i) { return padre->hijo[i]->elemNodo; });
+    Reorganizacion::Tramo tramo = Reorganizacion::Afectados(plan, indiceHijo);
+    if (tramo.cuantos > 0) Repartir(padre, tramo.desde, tramo.cuantos, tramo.nuevos);
+}
+
+/**
+ * @brief Reparte las claves de hijos consecutivos y sus separadoras en otra cantidad de hijos.
+ *
+ * Cada reorganización es un caso de esta: parejar con un vecino o a lo largo de una cascada
+ * (nuevos == cuantos), dividir (nuevos == cuantos + 1) y fusionar (nuevos == cuantos - 1).
+ * Como cada hoja tocada se recodifica entera, parejar todo el tramo de una cascada cuesta
+ * lo mismo que rotar una clave por cada intermedio.
+ *
+ * @param padre Nodo padre.
+ * @param desde Primer hijo del tramo.
+ * @param cuantos Hijos del tramo.
+ * @param nuevos Hijos que quedan en su lugar (reparto de Reorganizacion::Parte).
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Repartir(Interno* padre, int desde, int cuantos, int nuevos) {
+    bool hoja = padre->hijo[desde]->hoja;
+    tramoClaves.clear();
+    tramoHijos.clear();
+    for (int k = 0; k < cuantos; ++k) {
+        const Nodo* nodo = padre->hijo[desde + k];
+        std::size_t n = tramoClaves.size();
+        tramoClaves.resize(n + nodo->elemNodo);
+        Extraer(nodo, tramoClaves.data() + n);
+        if (k < cuantos - 1) tramoClaves.push_back(padre->claves[desde + k]);
+        if (!hoja) {
+            const Interno* interno = ComoInterno(nodo);
+            for (int i = 0; i <= nodo->elemNodo; ++i) tramoHijos.push_back(interno->hijo[i]);
+        }
+    }
+    int resto = static_cast<int>(tramoClaves.size()) - (nuevos - 1);
+
+    // Se reusan los nodos del tramo; los que faltan se crean y los que sobran se liberan
+    Nodo* nodos[grado + 2];
+    for (int k = 0; k < nuevos; ++k) {
+        if (k < cuantos) {
+            nodos[k] = padre->hijo[desde + k];
+        } else {
+            nodos[k] = hoja ? static_cast<Nodo*>(new Hoja()) : static_cast<Nodo*>(new Interno());
+        }
+    }
+    for (int k = nuevos; k < cuantos; ++k) Destruir(padre->hijo[desde + k]);
+
+    Type separadoras[grado + 1];
+    int idx = 0;
+    int idxHijos = 0;
+    for (int k = 0; k < nuevos; ++k) {
+        int n = Reorganizacion::Parte(resto, nuevos, k);
+        Escribir(nodos[k], tramoClaves.data() + idx, n);
+        idx += n;
+        if (k < nuevos - 1) separadoras[k] = tramoClaves[idx++];
+        if (!hoja) {
+            Interno* interno = ComoInterno(nodos[k]);
+            for (int i = 0; i <= grado; ++i) interno->hijo[i] = (i <= n) ? tramoHijos[idxHijos++] : nullptr;
+        }
+    }
+
+    // En el padre, las separadoras e hijos del tramo se reemplazan por los nuevos
+    Type claves[grado + 1];
+    Nodo* hijos[grado + 2];
+    int nC = 0;
+    int nH = 0;
+    for (int i = 0; i < desde; ++i) {
+        claves[nC++] = padre->claves[i];
+        hijos[nH++] = padre->hijo[i];
+    }
+    for (int k = 0; k < nuevos; ++k) {
+        if (k < nuevos - 1) claves[nC++] = separadoras[k];
+        hijos[nH++] = nodos[k];
+    }
+    for (int i = desde + cuantos - 1; i < padre->elemNodo; ++i) {
+        claves[nC++] = padre->claves[i];
+        hijos[nH++] = padre->hijo[i + 1];
+    }
+    for (int i = 0; i < nC; ++i) padre->claves[i] = claves[i];
+    for (int i = 0; i <= grado; ++i) padre->hijo[i] = (i < nH) ? hijos[i] : nullptr;
+    padre->elemNodo = nC;
+}
+
+/**
+ * @brief Divide la raíz desbordada en dos nodos bajo una raíz nueva.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::DividirRaiz() {
+    Interno* nueva = new Interno();
+    nueva->hijo[0] = raiz;
+    raiz = nueva;
+    Repartir(nueva, 0, 1, 2);
+}
+
+/**
+ * @brief Busca un valor bajando desde la raíz; en la hoja compara desplazamientos sin decodificarla.
+ * @param valor Valor a buscar.
+ * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Buscar(Type valor) const {
+    const Nodo* nodo = raiz;
+    if (nodo == nullptr) return false;
+    while (!nodo->hoja) {
+        const Interno* interno = ComoInterno(nodo);
+        int i = Busqueda::Posicion(interno->claves, interno->elemNodo, valor);
+        if (i < interno->elemNodo && interno->claves[i] == valor) return true;
+        nodo = interno->hijo[i];
+    }
+
+    const Hoja* hoja = ComoHoja(nodo);
+    int i = Compresion::Posicion(hoja->base, hoja->ancho, hoja->Datos(), hoja->elemNodo, valor);
+    return i < hoja->elemNodo && Compresion::Leer(hoja->base, hoja->ancho, hoja->Datos(), i) == valor;
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos.
+ * @return Número de elementos.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+int StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::CantElem() const {
+    return cantElem;
+}
+
+/**
+ * @brief Devuelve la cantidad de niveles; todas las hojas están a la misma profundidad.
+ * @return Altura del árbol (0 si está vacío).
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+int StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Altura() const {
+    int altura = 0;
+    for (const Nodo* nodo = raiz; nodo != nullptr; nodo = nodo->hoja ? nullptr : ComoInterno(nodo)->hijo[0]) {
+        ++altura;
+    }
+    return altura;
+}
+
+/**
+ * @brief Visita en orden los elementos en [desde, hasta].
+ * @param desde Límite inferior (inclusivo).
+ * @param hasta Límite superior (inclusivo).
+ * @param fn Función a aplicar; si devuelve bool, false detiene el recorrido.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+template <typename Funcion>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::RecorrerRango(Type desde, Type hasta, Funcion fn) const {
+    if (raiz == nullptr || hasta < desde) return;
+    RecorrerRango(raiz, desde, hasta, fn);
+}
+
+/**
+ * @brief Recorre recursivamente un subárbol dentro del rango; cada hoja se decodifica una vez.
+ * @return false si el recorrido terminó (se pasó de hasta o fn pidió detenerse).
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+template <typename Funcion>
+bool StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::RecorrerRango(const Nodo* nodo, Type desde, Type hasta, Funcion& fn) const {
+    auto visitar = [&fn](Type clave) {
+        if constexpr (std::is_same<decltype(fn(clave)), bool>::value) {
+            return fn(clave);
+        } else {
+            fn(clave);
+            return true;
+        }
+    };
+
+    if (nodo->hoja) {
+        const Hoja* hoja = ComoHoja(nodo);
+        int n = hoja->elemNodo;
+        int i = Compresion::Posicion(hoja->base, hoja->ancho, hoja->Datos(), n, desde);
+        Type claves[gradoHoja];
+        Compresion::Desempaquetar(hoja->base, hoja->ancho, hoja->Datos(), i, n, claves);
+        for (int j = 0; j < n - i; ++j) {
+            if (hasta < claves[j] || !visitar(claves[j])) return false;
+        }
+        return true;
+    }
+
+    const Interno* interno = ComoInterno(nodo);
+    int i = Busqueda::Posicion(interno->claves, interno->elemNodo, desde);
+    for (; i < interno->elemNodo; ++i) {
+        if (!RecorrerRango(interno->hijo[i], desde, hasta, fn)) return false;
+        if (hasta < interno->claves[i] || !visitar(interno->claves[i])) return false;
+    }
+    return RecorrerRango(interno->hijo[interno->elemNodo], desde, hasta, fn);
+}
+
+/**
+ * @brief Vacía el árbol y libera toda su memoria.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Vaciar() {
+    Vaciar(raiz);
+    raiz = nullptr;
+    cantElem = 0;
+}
+
+/**
+ * @brief Libera un nodo (sin sus hijos) y los desplazamientos externos de una hoja.
+ * @param nodo Nodo a liberar.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Destruir(Nodo* nodo) {
+    if (nodo->hoja) {
+        Hoja* hoja = ComoHoja(nodo);
+        if (hoja->capacidad > 0) delete[] hoja->externos;
+        delete hoja;
+    } else {
+        delete ComoInterno(nodo);
+    }
+}
+
+/**
+ * @brief Libera recursivamente un subárbol.
+ * @param nodo Raíz del subárbol.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+void StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::Vaciar(Nodo* nodo) {
+    if (nodo == nullptr) return;
+    if (!nodo->hoja) {
+        Interno* interno = ComoInterno(nodo);
+        for (int i = 0; i <= interno->elemNodo; ++i) Vaciar(interno->hijo[i]);
+    }
+    Destruir(nodo);
+}
+
+/**
+ * @brief Devuelve la memoria ocupada por los nodos y los desplazamientos reservados fuera de las hojas.
+ * @return Bytes totales.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+std::size_t StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::BytesNodos() const {
+    return BytesNodos(raiz);
+}
+
+/**
+ * @brief Suma recursivamente la memoria de un subárbol.
+ */
+template <typename Type, int grado, int gradoHoja, typename Desborde>
+std::size_t StarBTreeEnteros<Type, grado, gradoHoja, Desborde>::BytesNodos(const Nodo* nodo) const {
+    if (nodo == nullptr) return 0;
+    if (nodo->hoja) return sizeof(Hoja) + ComoHoja(nodo)->capacidad;
+    const Interno* interno = ComoInterno(nodo);
+    std::size_t total = sizeof(Interno);
+    for (int i = 0; i <= interno->elemNodo; ++i) total += BytesNodos(interno->hijo[i]);
+    return total;
+}
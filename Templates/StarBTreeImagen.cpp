@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "../Headers/StarBTreeImagen.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file StarBTreeImagen.tpp
+ * @brief Implementación de la vista de solo lectura sobre una imagen de StarBTree.
+ * @tparam Type Tipo de los elementos (trivialmente copiable).
+ * @tparam Compare Orden estricto de las claves; debe ser el del árbol que escribió la imagen.
+ */
+
+/**
+ * @brief Tamaño de un nodo de la imagen, redondeado para que el siguiente quede alineado.
+ * @param clavesPorNodo Capacidad de claves del nodo.
+ */
+template <typename Type, typename Compare>
+constexpr std::size_t StarBTreeImagen<Type, Compare>::TamRegistro(std::size_t clavesPorNodo) {
+    std::size_t alineacion = alignof(Type) > 4 ? alignof(Type) : 4;
+    std::size_t bytes = desplClaves + clavesPorNodo * sizeof(Type);
+    return (bytes + alineacion - 1) / alineacion * alineacion;
+}
+
+/**
+ * @brief Acumula bytes en una suma FNV-1a de 64 bits.
+ * @param suma Suma acumulada (semillaSuma al comenzar).
+ * @param datos Bytes a acumular.
+ * @param tam Cantidad de bytes.
+ * @return Suma actualizada.
+ */
+template <typename Type, typename Compare>
+std::uint64_t StarBTreeImagen<Type, Compare>::Sumar(std::uint64_t suma, const unsigned char* datos, std::size_t tam) {
+    for (std::size_t i = 0; i < tam; ++i) {
+        suma ^= datos[i];
+        suma *= 1099511628211ull;
+    }
+    return suma;
+}
+
+/**
+ * @brief Proyecta la imagen en memoria y valida la cabecera.
+ * @param ruta Ruta del archivo escrito por StarBTree::Guardar.
+ * @param verificar true para comprobar la suma de verificación (lee la imagen completa una vez).
+ * @param comparar Orden de las claves.
+ * @throws std::runtime_error Si el archivo no se puede leer, no es una imagen de este tipo
+ * de clave o está dañado.
+ */
+template <typename Type, typename Compare>
+StarBTreeImagen<Type, Compare>::StarBTreeImagen(const std::string& ruta, bool verificar, const Compare& comparar)
+    : base(nullptr), tam(0), proyectado(false), cabecera(), comparar(comparar) {
+    Abrir(ruta);
+    try {
+        Validar(verificar);
+    } catch (...) {
+        Cerrar();
+        throw;
+    }
+}
+
+/**
+ * @brief Libera la proyección del archivo.
+ */
+template <typename Type, typename Compare>
+StarBTreeImagen<Type, Compare>::~StarBTreeImagen() {
+    Cerrar();
+}
+
+/**
+ * @brief Deshace la proyección, si la hay.
+ */
+template <typename Type, typename Compare>
+void StarBTreeImagen<Type, Compare>::Cerrar() {
+#if defined(__unix__) || defined(__APPLE__)
+    if (proyectado) munmap(const_cast<unsigned char*>(base), tam);
+#endif
+    proyectado = false;
+}
+
+/**
+ * @brief Proyecta el archivo o, sin mmap, lo lee completo.
+ * @throws std::runtime_error Si no se puede abrir o proyectar.
+ */
+template <typename Type, typename Compare>
+void StarBTreeImagen<Type, Compare>::Abrir(const std::string& ruta) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = open(ruta.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("No se pudo abrir la imagen " + ruta);
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("No se pudo leer el tamaño de la imagen " + ruta);
+    }
+    tam = static_cast<std::size_t>(info.st_size);
+    if (tam > 0) {
+        void* p = mmap(nullptr, tam, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) throw std::runtime_error("No se pudo proyectar la imagen " + ruta);
+        base = static_cast<const unsigned char*>(p);
+        proyectado = true;
+    } else {
+        close(fd);
+    }
+#else
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo) throw std::runtime_error("No se pudo abrir la imagen " + ruta);
+    copia.assign(std::istreambuf_iterator<char>(archivo), std::istreambuf_iterator<char>());
+    base = copia.data();
+    tam = copia.size();
+#endif
+}
+
+/**
+ * @brief Comprueba firma, versión, tipo de clave, tamaño y (opcionalmente) la suma.
+ * @throws std::runtime_error Si algo no coincide.
+ */
+template <typename Type, typename Compare>
+void StarBTreeImagen<Type, Compare>::Validar(bool verificar) {
+    if (tam < sizeof(Cabecera)) throw std::runtime_error("La imagen está truncada");
+    std::memcpy(&cabecera, base, sizeof(Cabecera));
+
+    if (cabecera.firma != firmaImagen || cabecera.version != versionImagen) {
+        throw std::runtime_error("El archivo no es una imagen de StarBTree");
+    }
+    if (cabecera.tamClave != sizeof(Type) || cabecera.tamRegistro != TamRegistro(cabecera.clavesPorNodo)) {
+        throw std::runtime_error("La imagen se escribió con otro tipo de clave");
+    }
+    // Dividir en lugar de multiplicar: una cantNodos dañada no puede desbordar la cuenta
+    std::size_t datos = tam - sizeof(Cabecera);
+    if (datos % cabecera.tamRegistro != 0 || cabecera.cantNodos != datos / cabecera.tamRegistro) {
+        throw std::runtime_error("El tamaño de la imagen no coincide con su cabecera");
+    }
+    if (verificar && Sumar(semillaSuma, base + sizeof(Cabecera), tam - sizeof(Cabecera)) != cabecera.sumaVerificacion) {
+        throw std::runtime_error("La suma de verificación de la imagen no coincide");
+    }
+}
+
+/**
+ * @brief Devuelve el registro de un nodo tras comprobar que sus campos son coherentes.
+ *
+ * Los hijos deben estar dentro de la imagen y después del nodo (el orden por niveles lo
+ * garantiza), así que un descenso siempre termina.
+ *
+ * @param nodo Índice del nodo, menor que cantNodos.
+ * @throws std::runtime_error Si el nodo tiene más claves que la capacidad o hijos fuera de lugar.
+ */
+template <typename Type, typename Compare>
+const unsigned char* StarBTreeImagen<Type, Compare>::Visitar(std::uint64_t nodo) const {
+    const unsigned char* r = Registro(nodo);
+    std::uint64_t n = ElemNodo(r);
+    std::uint64_t primerHijo = PrimerHijo(r);
+    if (n > cabecera.clavesPorNodo || (primerHijo != 0 && (primerHijo <= nodo || primerHijo + n >= cabecera.cantNodos))) {
+        throw std::runtime_error("La imagen está dañada");
+    }
+    return r;
+}
+
+/**
+ * @brief Busca un valor bajando por los nodos de la imagen.
+ * @param valor Valor a buscar.
+ * @return true si el valor está en la imagen.
+ * @throws std::runtime_error Si un nodo del camino está dañado.
+ */
+template <typename Type, typename Compare>
+bool StarBTreeImagen<Type, Compare>::Buscar(const Type& valor) const {
+    if (cabecera.cantNodos == 0) return false;
+
+    std::uint64_t nodo = 0;
+    while (true) {
+        const unsigned char* r = Visitar(nodo);
+        const Type* claves = Claves(r);
+        std::uint32_t n = ElemNodo(r);
+        std::uint32_t i = std::lower_bound(claves, claves + n, valor, comparar) - claves;
+
+        if (i < n && !comparar(valor, claves[i])) return true;
+        if (PrimerHijo(r) == 0) return false;
+        nodo = PrimerHijo(r) + i;
+    }
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos guardados en la imagen.
+ */
+template <typename Type, typename Compare>
+std::size_t StarBTreeImagen<Type, Compare>::CantElem() const {
+    return cabecera.cantElem;
+}
+
+/**
+ * @brief Visita en orden los elementos en [desde, hasta].
+ * @param desde Límite inferior (inclusivo).
+ * @param hasta Límite superior (inclusivo).
+ * @param fn Función a aplicar; si devuelve bool, false detiene el recorrido.
+ * @throws std::runtime_error Si un nodo visitado está dañado.
+ */
+template <typename Type, typename Compare>
+template <typename Funcion>
+void StarBTreeImagen<Type, Compare>::RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const {
+    if (cabecera.cantNodos == 0 || comparar(hasta, desde)) return;
+    RecorrerRango(0, &desde, &hasta, fn);
+}
+
+/**
+ * @brief Visita en orden todos los elementos de la imagen.
+ * @param fn Función a aplicar; si devuelve bool, false detiene el recorrido.
+ * @throws std::runtime_error Si un nodo visitado está dañado.
+ */
+template <typename Type, typename Compare>
+template <typename Funcion>
+void StarBTreeImagen<Type, Compare>::Recorrer(Funcion fn) const {
+    if (cabecera.cantNodos == 0) return;
+    RecorrerRango(0, nullptr, nullptr, fn);
+}
+
+/**
+ * @brief Recorre recursivamente el subárbol del nodo dentro del rango.
+ * @param desde Límite inferior, o nullptr si no hay.
+ * @param hasta Límite superior, o nullptr si no hay.
+ * @return false si el recorrido terminó (se pasó de hasta o fn pidió detenerse).
+ */
+template <typename Type, typename Compare>
+template <typename Funcion>
+bool StarBTreeImagen<Type, Compare>::RecorrerRango(std::uint64_t nodo, const Type* desde, const Type* hasta, Funcion& fn) const {
+    const unsigned char* r = Visitar(nodo);
+    const Type* claves = Claves(r);
+    std::uint32_t n = ElemNodo(r);
+    std::uint32_t primerHijo = PrimerHijo(r);
+    std::uint32_t i = (desde != nullptr) ? std::lower_bound(claves, claves + n, *desde, comparar) - claves : 0;
+
+    for (; i < n; ++i) {
+        if (primerHijo != 0 && !RecorrerRango(primerHijo + i, desde, hasta, fn)) return false;
+        if (hasta != nullptr && comparar(*hasta, claves[i])) return false;
+
+        if constexpr (std::is_same<decltype(fn(claves[i])), bool>::value) {
+            if (!fn(claves[i])) return false;
+        } else {
+            fn(claves[i]);
+        }
+    }
+    return primerHijo == 0 || RecorrerRango(primerHijo + n, desde, hasta, fn);
+}
@@ -0,0 +1,160 @@
+#include <utility>
+#include "../Headers/StarBTreeMap.hpp"
+
+/**
+ * @file StarBTreeMap.tpp
+ * @brief Implementación del mapa ordenado sobre un Árbol B* (StarBTreeMap).
+ * @details Todas las operaciones delegan en un StarBTree cuya carga es el valor; el mapa
+ * solo traduce la interfaz de std::map y expone los pares a través de sus iteradores.
+ * @tparam Key Tipo de las claves.
+ * @tparam Value Tipo de los valores asociados.
+ * @tparam grado Grado del árbol (número máximo de claves por nodo excepto la raíz).
+ * @tparam Traza Política que recibe los eventos estructurales (TrazaNula por defecto).
+ * @tparam Asignador Política de memoria de los nodos (PoolNodos por defecto).
+ */
+
+/**
+ * @brief Constructor por defecto del mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+StarBTreeMap<Key, Value, grado, Traza, Asignador>::StarBTreeMap() : arbol() {}
+
+/**
+ * @brief Busca una clave.
+ * @param clave Clave a buscar.
+ * @return Iterador al par, o end() si la clave no existe.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::find(const Key& clave) {
+    typename Arbol::const_iterator it = arbol.lower_bound(clave);
+    if (it == arbol.end() || clave < *it) return end();
+    return iterator(arbol.Modificable(it));
+}
+
+/**
+ * @brief Busca una clave (versión constante).
+ * @param clave Clave a buscar.
+ * @return Iterador al par, o end() si la clave no existe.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::const_iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::find(const Key& clave) const {
+    typename Arbol::const_iterator it = arbol.lower_bound(clave);
+    if (it == arbol.end() || clave < *it) return end();
+    return const_iterator(it);
+}
+
+/**
+ * @brief Indica si la clave está en el mapa.
+ * @param clave Clave a buscar.
+ * @return true si la clave existe.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+bool StarBTreeMap<Key, Value, grado, Traza, Asignador>::Buscar(const Key& clave) const {
+    return arbol.Buscar(clave);
+}
+
+/**
+ * @brief Acceso al valor de una clave, insertando un valor por defecto si no existe.
+ * @param clave Clave buscada.
+ * @return Referencia al valor asociado.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+Value& StarBTreeMap<Key, Value, grado, Traza, Asignador>::operator[](const Key& clave) {
+    return arbol.Colocar(clave).first.carga();
+}
+
+/**
+ * @brief Inserta el par o reemplaza el valor si la clave ya existe.
+ * @param clave Clave.
+ * @param valor Valor a asignar.
+ * @return Par (iterador al elemento, true si la clave era nueva).
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+template <typename V>
+std::pair<typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::iterator, bool>
+StarBTreeMap<Key, Value, grado, Traza, Asignador>::insert_or_assign(const Key& clave, V&& valor) {
+    // Colocar no usa valor si la clave ya estaba, así que aún se puede asignar
+    auto colocado = arbol.Colocar(clave, std::forward<V>(valor));
+    if (!colocado.second) colocado.first.carga() = std::forward<V>(valor);
+    return std::make_pair(iterator(colocado.first), colocado.second);
+}
+
+/**
+ * @brief Construye el valor con args solo si la clave no existe.
+ * @param clave Clave.
+ * @param args Argumentos para construir el valor.
+ * @return Par (iterador al elemento, true si la clave era nueva).
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+template <typename... Args>
+std::pair<typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::iterator, bool>
+StarBTreeMap<Key, Value, grado, Traza, Asignador>::try_emplace(const Key& clave, Args&&... args) {
+    auto colocado = arbol.Colocar(clave, std::forward<Args>(args)...);
+    return std::make_pair(iterator(colocado.first), colocado.second);
+}
+
+/**
+ * @brief Elimina una clave y su valor.
+ * @param clave Clave a eliminar.
+ * @return true si la clave existía y se eliminó.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+bool StarBTreeMap<Key, Value, grado, Traza, Asignador>::Eliminar(const Key& clave) {
+    return arbol.Eliminar(clave);
+}
+
+/**
+ * @brief Devuelve la cantidad de pares del mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+int StarBTreeMap<Key, Value, grado, Traza, Asignador>::CantElem() const {
+    return arbol.CantElem();
+}
+
+/**
+ * @brief Vacía el mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+void StarBTreeMap<Key, Value, grado, Traza, Asignador>::Vaciar() {
+    arbol.Vaciar();
+}
+
+/**
+ * @brief Iterador al par de menor clave.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::begin() {
+    return iterator(arbol.Modificable(arbol.begin()));
+}
+
+/**
+ * @brief Iterador al final del mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::end() {
+    return iterator(arbol.Modificable(arbol.end()));
+}
+
+/**
+ * @brief Iterador constante al par de menor clave.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::const_iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::begin() const {
+    return const_iterator(arbol.begin());
+}
+
+/**
+ * @brief Iterador constante al final del mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+typename StarBTreeMap<Key, Value, grado, Traza, Asignador>::const_iterator StarBTreeMap<Key, Value, grado, Traza, Asignador>::end() const {
+    return const_iterator(arbol.end());
+}
+
+/**
+ * @brief Devuelve la política de traza asociada al mapa.
+ */
+template <typename Key, typename Value, int grado, typename Traza, template <typename> class Asignador>
+Traza& StarBTreeMap<Key, Value, grado, Traza, Asignador>::ObtenerTraza() {
+    return arbol.ObtenerTraza();
+}
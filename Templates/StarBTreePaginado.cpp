@@ -0,0 +1,513 @@
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../Headers/StarBTreePaginado.hpp"
+
+/**
+ * @file StarBTreePaginado.tpp
+ * @brief Implementación del Árbol B* guardado en páginas de un archivo.
+ * @details Las operaciones son las del StarBTree en memoria, pero cada acceso a un nodo
+ * fija su página en el buffer y la libera al salir del ámbito; las páginas modificadas se
+ * marcan para escribirse cuando se desalojen o al sincronizar.
+ * @tparam Type Tipo de los elementos (trivialmente copiable).
+ * @tparam grado Grado del árbol (número máximo de claves por nodo más uno).
+ * @tparam Compare Orden estricto de las claves (std::less<Type> por defecto).
+ * @tparam Desborde Política para los hijos desbordados (ver PoliticaDesborde).
+ */
+
+/**
+ * @brief Abre el árbol guardado en ruta, o lo crea vacío si el archivo no existe o está vacío.
+ * @param ruta Ruta del archivo de páginas.
+ * @param marcos Páginas que pueden estar en memoria a la vez (presupuesto de memoria); ninguna
+ * operación fija más de cuatro páginas a la vez, así que el mínimo de BufferPaginas alcanza
+ * sea cual sea la altura.
+ * @param comparar Orden de las claves; debe ser el mismo con el que se creó el archivo.
+ * @throws std::runtime_error Si el archivo no es de este árbol o fue creado con otro grado o tipo.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+StarBTreePaginado<Type, grado, Compare, Desborde>::StarBTreePaginado(const std::string& ruta, std::size_t marcos,
+                                                                    const Compare& comparar)
+    : buffer(ruta, marcos), raiz(0), cantElem(0), comparar(comparar) {
+    if (buffer.CantPaginas() > 0) {
+        LeerCabecera();
+        return;
+    }
+
+    Fijada cabecera = buffer.Nueva(); // Página 0
+    Fijada hoja = buffer.Nueva();
+    hoja->hoja = true;
+    raiz = hoja.Id();
+    EscribirCabecera();
+}
+
+/**
+ * @brief Escribe la cabecera y las páginas sucias antes de cerrar el archivo.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+StarBTreePaginado<Type, grado, Compare, Desborde>::~StarBTreePaginado() {
+    try {
+        EscribirCabecera();
+    } catch (...) {
+    }
+}
+
+/**
+ * @brief Inserta un valor con un único descenso desde la raíz.
+ *
+ * Al bajar se fija una página a la vez y se anota el camino; al subir, cada desborde fija
+ * de nuevo solo el padre, el hijo, un hermano y la página nueva de una división. Así la
+ * cantidad de marcos fijados no depende de la altura y la inserción no puede quedar a
+ * medias por falta de marcos.
+ *
+ * @param valor Valor a insertar.
+ * @return true si el valor se insertó, false si ya estaba en el árbol.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreePaginado<Type, grado, Compare, Desborde>::Insertar(const Type& valor) {
+    std::vector<std::pair<IdPagina, int>> camino; // Página de cada ancestro e hijo por el que se bajó
+    IdPagina id = raiz;
+    while (true) {
+        Fijada nodo = buffer.Fijar(id);
+        int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+        if (i < nodo->elemNodo && !comparar(valor, nodo->claves[i])) return false;
+
+        if (nodo->hoja) {
+            for (int j = nodo->elemNodo; j > i; --j) {
+                nodo->claves[j] = nodo->claves[j - 1];
+            }
+            nodo->claves[i] = valor;
+            nodo->elemNodo++;
+            nodo.Modificada();
+            cantElem++;
+            if (nodo->elemNodo < grado) return true;
+            break;
+        }
+        camino.emplace_back(id, i);
+        id = nodo->hijo[i];
+    }
+
+    // Tras bajar, si ese hijo se llenó, reequilibrar; el padre puede llenarse a su vez
+    for (auto it = camino.rbegin(); it != camino.rend(); ++it) {
+        Fijada padre = buffer.Fijar(it->first);
+        Fijada hijo = buffer.Fijar(padre->hijo[it->second]);
+        OrdenarHijo(padre, hijo, it->second);
+        if (padre->elemNodo < grado) return true;
+    }
+
+    // La raíz no tiene hermanos: si se llena, se divide y el árbol crece
+    DividirRaiz();
+    return true;
+}
+
+/**
+ * @brief Hace lugar en un hijo desbordado según el plan de Reorganizacion::Desbordar.
+ *
+ * Para decidir se fija un hermano a la vez y solo para leer su cantidad de claves. Con
+ * DesbordeCascada cada hermano intermedio cuesta una página escrita más; las demás
+ * políticas modifican a lo sumo el padre, el hijo, un hermano y una página nueva.
+ *
+ * @param padre Página del padre.
+ * @param hijo Página del hijo desbordado.
+ * @param indiceHijo Índice del hijo en el padre.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::OrdenarHijo(Fijada& padre, Fijada& hijo, int indiceHijo) {
+    Reorganizacion::Plan plan = Reorganizacion::Desbordar<Desborde>(
+        indiceHijo, padre->elemNodo, grado, [&](int i) { return i == indiceHijo ? hijo->elemNodo : buffer.Fijar(padre->hijo[i])->elemNodo; });
+
+    switch (plan.accion) {
+        case Reorganizacion::Accion::Cascada:
+            if (plan.indice < indiceHijo) {
+                for (int j = plan.indice; j < indiceHijo; ++j) Rotar(padre, j, false);
+            } else {
+                for (int j = plan.indice; j > indiceHijo; --j) Rotar(padre, j - 1, true);
+            }
+            break;
+        case Reorganizacion::Accion::Nivelar:
+        case Reorganizacion::Accion::DividirTriple: {
+            // El hijo es uno de los dos; solo se fija el hermano
+            bool esIzquierdo = plan.indice == indiceHijo;
+            Fijada hermano = buffer.Fijar(padre->hijo[esIzquierdo ? plan.indice + 1 : plan.indice]);
+            Fijada& izquierdo = esIzquierdo ? hijo : hermano;
+            Fijada& derecho = esIzquierdo ? hermano : hijo;
+            if (plan.accion == Reorganizacion::Accion::Nivelar) {
+                Repartir(padre, izquierdo, derecho, plan.indice);
+            } else {
+                DividirTriple(padre, izquierdo, derecho, plan.indice);
+            }
+            break;
+        }
+        default: DividirDoble(padre, hijo, indiceHijo); break;
+    }
+}
+
+/**
+ * @brief Pasa una clave de un hermano al otro a través de la separadora del padre.
+ * @param padre Página del padre.
+ * @param indice Índice de la clave separadora entre hijo[indice] e hijo[indice + 1].
+ * @param haciaDerecha true para pasar la última clave de hijo[indice] al comienzo de
+ * hijo[indice + 1], false para pasar la primera de hijo[indice + 1] al final de hijo[indice].
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::Rotar(Fijada& padre, int indice, bool haciaDerecha) {
+    Fijada izquierdo = buffer.Fijar(padre->hijo[indice]);
+    Fijada derecho = buffer.Fijar(padre->hijo[indice + 1]);
+    bool hoja = izquierdo->hoja;
+    int nI = izquierdo->elemNodo;
+    int nD = derecho->elemNodo;
+
+    if (haciaDerecha) {
+        for (int j = nD; j > 0; --j) derecho->claves[j] = derecho->claves[j - 1];
+        derecho->claves[0] = padre->claves[indice];
+        padre->claves[indice] = izquierdo->claves[nI - 1];
+        if (!hoja) {
+            for (int j = nD + 1; j > 0; --j) derecho->hijo[j] = derecho->hijo[j - 1];
+            derecho->hijo[0] = izquierdo->hijo[nI];
+            izquierdo->hijo[nI] = 0;
+        }
+        izquierdo->elemNodo--;
+        derecho->elemNodo++;
+    } else {
+        izquierdo->claves[nI] = padre->claves[indice];
+        padre->claves[indice] = derecho->claves[0];
+        for (int j = 0; j < nD - 1; ++j) derecho->claves[j] = derecho->claves[j + 1];
+        if (!hoja) {
+            izquierdo->hijo[nI + 1] = derecho->hijo[0];
+            for (int j = 0; j < nD; ++j) derecho->hijo[j] = derecho->hijo[j + 1];
+            derecho->hijo[nD] = 0;
+        }
+        izquierdo->elemNodo++;
+        derecho->elemNodo--;
+    }
+
+    padre.Modificada();
+    izquierdo.Modificada();
+    derecho.Modificada();
+}
+
+/**
+ * @brief Reparte en partes iguales las claves de dos hermanos y su separadora.
+ * @param padre Página del padre.
+ * @param izquierdo Página de hijo[indice].
+ * @param derecho Página de hijo[indice + 1].
+ * @param indice Índice de la clave separadora entre ambos hermanos.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::Repartir(Fijada& padre, Fijada& izquierdo, Fijada& derecho, int indice) {
+    bool hoja = izquierdo->hoja;
+    int nI = izquierdo->elemNodo;
+    int nD = derecho->elemNodo;
+
+    Type claves[2 * grado + 1];
+    IdPagina hijos[2 * grado + 2];
+    int total = 0;
+    int totalHijos = 0;
+
+    for (int i = 0; i < nI; ++i) claves[total++] = izquierdo->claves[i];
+    claves[total++] = padre->claves[indice];
+    for (int i = 0; i < nD; ++i) claves[total++] = derecho->claves[i];
+    if (!hoja) {
+        for (int i = 0; i <= nI; ++i) hijos[totalHijos++] = izquierdo->hijo[i];
+        for (int i = 0; i <= nD; ++i) hijos[totalHijos++] = derecho->hijo[i];
+    }
+
+    // La separadora queda en el padre; el resto se reparte por mitades
+    int clavesI = Reorganizacion::Mitad(total - 1);
+    int clavesD = total - 1 - clavesI;
+
+    int idx = 0;
+    for (int i = 0; i < clavesI; ++i) izquierdo->claves[i] = claves[idx++];
+    padre->claves[indice] = claves[idx++];
+    for (int i = 0; i < clavesD; ++i) derecho->claves[i] = claves[idx++];
+
+    if (!hoja) {
+        idx = 0;
+        for (int i = 0; i <= grado; ++i) izquierdo->hijo[i] = (i <= clavesI) ? hijos[idx++] : 0;
+        for (int i = 0; i <= grado; ++i) derecho->hijo[i] = (i <= clavesD) ? hijos[idx++] : 0;
+    }
+    izquierdo->elemNodo = clavesI;
+    derecho->elemNodo = clavesD;
+
+    padre.Modificada();
+    izquierdo.Modificada();
+    derecho.Modificada();
+}
+
+/**
+ * @brief Divide dos hermanos (uno desbordado y otro lleno) en tres; el padre gana una clave.
+ * @param padre Página del padre.
+ * @param A Página de hijo[indice].
+ * @param C Página de hijo[indice + 1].
+ * @param indice Índice del primero de los dos hermanos.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::DividirTriple(Fijada& padre, Fijada& A, Fijada& C, int indice) {
+    bool hoja = A->hoja;
+    Fijada B = buffer.Nueva();
+    B->hoja = hoja;
+    int nA = A->elemNodo;
+    int nC = C->elemNodo;
+
+    Type claves[2 * grado + 1];
+    IdPagina hijos[2 * grado + 2];
+    int total = 0;
+    int totalHijos = 0;
+
+    for (int i = 0; i < nA; ++i) claves[total++] = A->claves[i];
+    claves[total++] = padre->claves[indice];
+    for (int i = 0; i < nC; ++i) claves[total++] = C->claves[i];
+    if (!hoja) {
+        for (int i = 0; i <= nA; ++i) hijos[totalHijos++] = A->hijo[i];
+        for (int i = 0; i <= nC; ++i) hijos[totalHijos++] = C->hijo[i];
+    }
+
+    // Repartir las claves restantes (sin las dos separadoras) en tres tercios
+    Reorganizacion::Tercios tercios = Reorganizacion::Triple(total - 2);
+    int clavesA = tercios.a;
+    int clavesB = tercios.b;
+    int clavesC = tercios.c;
+
+    int idx = 0;
+    for (int i = 0; i < clavesA; ++i) A->claves[i] = claves[idx++];
+    Type sepAB = claves[idx++];
+    for (int i = 0; i < clavesB; ++i) B->claves[i] = claves[idx++];
+    Type sepBC = claves[idx++];
+    for (int i = 0; i < clavesC; ++i) C->claves[i] = claves[idx++];
+
+    if (!hoja) {
+        idx = 0;
+        for (int i = 0; i <= grado; ++i) A->hijo[i] = (i <= clavesA) ? hijos[idx++] : 0;
+        for (int i = 0; i <= clavesB; ++i) B->hijo[i] = hijos[idx++];
+        for (int i = 0; i <= grado; ++i) C->hijo[i] = (i <= clavesC) ? hijos[idx++] : 0;
+    }
+    A->elemNodo = clavesA;
+    B->elemNodo = clavesB;
+    C->elemNodo = clavesC;
+
+    // Desplazar claves e hijos en el padre para abrir lugar a B
+    for (int i = padre->elemNodo; i > indice + 1; --i) {
+        padre->claves[i] = padre->claves[i - 1];
+        padre->hijo[i + 1] = padre->hijo[i];
+    }
+    padre->elemNodo++;
+    padre->claves[indice] = sepAB;
+    padre->claves[indice + 1] = sepBC;
+    padre->hijo[indice + 1] = B.Id();
+    padre->hijo[indice + 2] = C.Id();
+
+    padre.Modificada();
+    A.Modificada();
+    C.Modificada();
+}
+
+/**
+ * @brief Parte un hijo desbordado en dos; la clave del medio sube al padre.
+ * @param padre Página del padre.
+ * @param hijo Página de hijo[indiceHijo].
+ * @param indiceHijo Índice del hijo en el padre.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::DividirDoble(Fijada& padre, Fijada& hijo, int indiceHijo) {
+    Fijada derecho = PartirMitad(hijo);
+
+    for (int i = padre->elemNodo; i > indiceHijo; --i) {
+        padre->claves[i] = padre->claves[i - 1];
+        padre->hijo[i + 1] = padre->hijo[i];
+    }
+    padre->elemNodo++;
+    padre->claves[indiceHijo] = hijo->claves[hijo->elemNodo];
+    padre->hijo[indiceHijo + 1] = derecho.Id();
+    padre.Modificada();
+}
+
+/**
+ * @brief Pasa la mitad derecha de una página llena a una página nueva.
+ *
+ * La original conserva las Mitad(grado) claves menores; la clave del medio, que debe subir
+ * al padre como separadora, queda en nodo->claves[nodo->elemNodo].
+ *
+ * @param nodo Página con grado claves.
+ * @return La página nueva con las claves mayores que la separadora.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+typename StarBTreePaginado<Type, grado, Compare, Desborde>::Fijada StarBTreePaginado<Type, grado, Compare, Desborde>::PartirMitad(Fijada& nodo) {
+    bool hoja = nodo->hoja;
+    Fijada derecho = buffer.Nueva();
+    derecho->hoja = hoja;
+
+    int clavesI = Reorganizacion::Mitad(grado);
+    int clavesD = grado - clavesI - 1;
+
+    for (int i = 0; i < clavesD; ++i) {
+        derecho->claves[i] = nodo->claves[clavesI + 1 + i];
+    }
+    if (!hoja) {
+        for (int i = 0; i <= clavesD; ++i) {
+            derecho->hijo[i] = nodo->hijo[clavesI + 1 + i];
+            nodo->hijo[clavesI + 1 + i] = 0;
+        }
+    }
+    derecho->elemNodo = clavesD;
+    nodo->elemNodo = clavesI;
+    nodo.Modificada();
+    return derecho;
+}
+
+/**
+ * @brief Divide la raíz desbordada en dos páginas bajo una raíz nueva.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::DividirRaiz() {
+    Fijada izquierdo = buffer.Fijar(raiz);
+    Fijada derecho = PartirMitad(izquierdo);
+
+    Fijada nueva = buffer.Nueva();
+    nueva->hoja = false;
+    nueva->claves[0] = izquierdo->claves[izquierdo->elemNodo];
+    nueva->elemNodo = 1;
+    nueva->hijo[0] = izquierdo.Id();
+    nueva->hijo[1] = derecho.Id();
+    raiz = nueva.Id();
+}
+
+/**
+ * @brief Busca un valor bajando desde la raíz.
+ * @param valor Valor a buscar.
+ * @return true si el valor se encuentra en el árbol, false en caso contrario.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+bool StarBTreePaginado<Type, grado, Compare, Desborde>::Buscar(const Type& valor) const {
+    IdPagina id = raiz;
+    while (true) {
+        Fijada nodo = buffer.Fijar(id);
+        int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, valor, comparar);
+        if (i < nodo->elemNodo && !comparar(valor, nodo->claves[i])) return true;
+        if (nodo->hoja) return false;
+        id = nodo->hijo[i];
+    }
+}
+
+/**
+ * @brief Devuelve la cantidad de elementos.
+ * @return Número de elementos.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+int StarBTreePaginado<Type, grado, Compare, Desborde>::CantElem() const {
+    return cantElem;
+}
+
+/**
+ * @brief Visita en orden los elementos en [desde, hasta].
+ * @param desde Límite inferior (inclusivo).
+ * @param hasta Límite superior (inclusivo).
+ * @param fn Función a aplicar; si devuelve bool, false detiene el recorrido.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+template <typename Funcion>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::RecorrerRango(const Type& desde, const Type& hasta, Funcion fn) const {
+    if (comparar(hasta, desde)) return;
+    RecorrerRango(raiz, desde, hasta, fn);
+}
+
+/**
+ * @brief Recorre recursivamente el subárbol de la página dada dentro del rango.
+ * @return false si el recorrido terminó (se pasó de hasta o fn pidió detenerse).
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+template <typename Funcion>
+bool StarBTreePaginado<Type, grado, Compare, Desborde>::RecorrerRango(IdPagina id, const Type& desde, const Type& hasta, Funcion& fn) const {
+    auto visitar = [&fn](const Type& clave) {
+        if constexpr (std::is_same<decltype(fn(clave)), bool>::value) {
+            return fn(clave);
+        } else {
+            fn(clave);
+            return true;
+        }
+    };
+
+    Pagina interno;
+    {
+        Fijada nodo = buffer.Fijar(id);
+        if (nodo->hoja) {
+            for (int i = Busqueda::Posicion(nodo->claves, nodo->elemNodo, desde, comparar); i < nodo->elemNodo; ++i) {
+                if (comparar(hasta, nodo->claves[i]) || !visitar(nodo->claves[i])) return false;
+            }
+            return true;
+        }
+        // Se copia para no dejar fijado todo el camino mientras se recorren los hijos
+        interno = *nodo;
+    }
+
+    int i = Busqueda::Posicion(interno.claves, interno.elemNodo, desde, comparar);
+    for (; i < interno.elemNodo; ++i) {
+        if (!RecorrerRango(interno.hijo[i], desde, hasta, fn)) return false;
+        if (comparar(hasta, interno.claves[i]) || !visitar(interno.claves[i])) return false;
+    }
+    return RecorrerRango(interno.hijo[interno.elemNodo], desde, hasta, fn);
+}
+
+/**
+ * @brief Escribe la cabecera y todas las páginas sucias al archivo.
+ * @throws std::runtime_error Si falla la escritura.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::Sincronizar() {
+    EscribirCabecera();
+    buffer.Sincronizar();
+}
+
+/**
+ * @brief Devuelve cuántas páginas se leyeron del archivo.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+std::size_t StarBTreePaginado<Type, grado, Compare, Desborde>::PaginasLeidas() const {
+    return buffer.Lecturas();
+}
+
+/**
+ * @brief Devuelve cuántas páginas se escribieron al archivo.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+std::size_t StarBTreePaginado<Type, grado, Compare, Desborde>::PaginasEscritas() const {
+    return buffer.Escrituras();
+}
+
+/**
+ * @brief Lee la página 0 y comprueba que el archivo corresponde a este árbol.
+ * @throws std::runtime_error Si la firma, la versión, el grado o el tamaño de clave no coinciden.
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::LeerCabecera() {
+    Cabecera c;
+    {
+        Fijada pagina = buffer.Fijar(0);
+        std::memcpy(&c, &*pagina, sizeof(Cabecera));
+    }
+    if (c.firma != firmaArchivo || c.version != versionArchivo) {
+        throw std::runtime_error("El archivo no contiene un StarBTreePaginado");
+    }
+    if (c.gradoArbol != static_cast<std::uint32_t>(grado) || c.tamClave != sizeof(Type)) {
+        throw std::runtime_error("El archivo se creó con otro grado o tipo de clave");
+    }
+    raiz = c.raiz;
+    cantElem = c.cantElem;
+}
+
+/**
+ * @brief Copia raíz y cantidad de elementos a la página 0 (se escribe al desalojarla o sincronizar).
+ */
+template <typename Type, int grado, typename Compare, typename Desborde>
+void StarBTreePaginado<Type, grado, Compare, Desborde>::EscribirCabecera() {
+    Cabecera c;
+    c.firma = firmaArchivo;
+    c.version = versionArchivo;
+    c.gradoArbol = grado;
+    c.tamClave = sizeof(Type);
+    c.raiz = raiz;
+    c.cantElem = cantElem;
+
+    Fijada pagina = buffer.Fijar(0);
+    std::memcpy(&*pagina, &c, sizeof(Cabecera));
+    pagina.Modificada();
+}
@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+#include "../Headers/StarBTreeConcurrente.hpp"
+
+/**
+ * @file concurrente.cpp
+ * @brief Prueba de estrés de StarBTreeConcurrente con escritores y lectores simultáneos.
+ * @details Cada escritor inserta su propia secuencia de claves pares (con repeticiones entre
+ * escritores) y publica cuántas lleva. Mientras tanto, los lectores buscan sin candados
+ * claves ya publicadas, que deben encontrarse, y claves impares, que nunca se insertan.
+ * Al terminar, el contenido debe coincidir con un std::set de todas las secuencias.
+ */
+
+static int fallos = 0;
+
+static void Verificar(bool condicion, const char* mensaje, int grado) {
+    if (!condicion) {
+        std::fprintf(stderr, "FALLO (grado %d): %s\n", grado, mensaje);
+        ++fallos;
+    }
+}
+
+template <int grado, typename Desborde = DesbordeVecino>
+static void Estres(int escritores, int lectores, int porEscritor, int rango) {
+    StarBTreeConcurrente<int, grado, std::less<int>, Desborde> arbol;
+
+    std::vector<std::vector<int>> claves(escritores);
+    std::mt19937 g(grado);
+    for (auto& secuencia : claves) {
+        for (int i = 0; i < porEscritor; ++i) secuencia.push_back(2 * static_cast<int>(g() % rango));
+    }
+
+    std::vector<std::atomic<int>> publicadas(escritores);
+    for (auto& p : publicadas) p.store(0);
+    std::atomic<int> activos(escritores);
+    std::atomic<int> nuevas(0);
+    std::atomic<int> perdidas(0), fantasmas(0);
+
+    std::vector<std::thread> hilos;
+    for (int w = 0; w < escritores; ++w) {
+        hilos.emplace_back([&, w] {
+            int propias = 0;
+            for (int i = 0; i < porEscritor; ++i) {
+                propias += arbol.Insertar(claves[w][i]);
+                publicadas[w].store(i + 1, std::memory_order_release);
+            }
+            nuevas += propias;
+            --activos;
+        });
+    }
+    for (int l = 0; l < lectores; ++l) {
+        hilos.emplace_back([&, l] {
+            std::mt19937 r(1000 + l);
+            while (activos.load() > 0) {
+                int w = r() % escritores;
+                int hechas = publicadas[w].load(std::memory_order_acquire);
+                if (hechas > 0 && !arbol.Buscar(claves[w][r() % hechas])) ++perdidas;
+                if (arbol.Buscar(2 * static_cast<int>(r() % rango) + 1)) ++fantasmas;
+            }
+        });
+    }
+    for (auto& h : hilos) h.join();
+
+    std::set<int> esperado;
+    for (const auto& secuencia : claves) esperado.insert(secuencia.begin(), secuencia.end());
+
+    Verificar(perdidas == 0, "un lector no encontró una clave ya insertada", grado);
+    Verificar(fantasmas == 0, "un lector encontró una clave nunca insertada", grado);
+    Verificar(nuevas == static_cast<int>(esperado.size()), "Insertar devolvió true más o menos veces que claves distintas", grado);
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide con std::set", grado);
+    bool todas = true;
+    for (int x : esperado) todas = todas && arbol.Buscar(x);
+    Verificar(todas, "falta una clave al terminar", grado);
+    bool ninguna = true;
+    for (int x = 1; x < 2 * rango; x += 2) ninguna = ninguna && !arbol.Buscar(x);
+    Verificar(ninguna, "sobra una clave al terminar", grado);
+}
+
+int main() {
+    int escritores = std::max(4u, std::thread::hardware_concurrency());
+    int lectores = 2;
+
+    // Rango chico: muchas repeticiones y reorganizaciones en los mismos nodos
+    Estres<4>(escritores, lectores, 20000, 5000);
+    Estres<5>(escritores, lectores, 20000, 50000);
+    Estres<16>(escritores, lectores, 50000, 200000);
+    Estres<64>(escritores, lectores, 50000, 1000000);
+    Estres<4, DesbordeClasico>(escritores, lectores, 20000, 5000);
+    Estres<5, DesbordeCascada>(escritores, lectores, 20000, 50000);
+    Estres<16, DesbordeTriple>(escritores, lectores, 20000, 200000);
+
+    if (fallos > 0) {
+        std::fprintf(stderr, "%d verificaciones fallaron\n", fallos);
+        return 1;
+    }
+    std::printf("concurrente: ok\n");
+    return 0;
+}
@@ -0,0 +1,543 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../Headers/StarBTree.hpp"
+
+/**
+ * @file starbtree.cpp
+ * @brief Compara StarBTree con std::set bajo cargas aleatorias de inserciones y eliminaciones.
+ * @details Cada prueba usa un rango chico de claves, de modo que se repiten y el árbol pasa
+ * muchas veces por redistribuciones, divisiones, préstamos y fusiones en los mismos nodos.
+ */
+
+static int fallos = 0;
+
+static void Verificar(bool condicion, const char* mensaje, const char* variante) {
+    if (!condicion) {
+        std::fprintf(stderr, "FALLO (%s): %s\n", variante, mensaje);
+        ++fallos;
+    }
+}
+
+template <int grado, bool conteos = false, typename Desborde = DesbordeVecino>
+using Arbol = StarBTree<int, grado, TrazaNula, PoolNodos, std::less<int>, conteos, Desborde>;
+
+/// Recorre begin()..end() (del árbol o de una instantánea) y lo compara con el conjunto
+template <typename Recorrible>
+static bool Coincide(const Recorrible& r, const std::set<int>& esperado) {
+    return std::equal(r.begin(), r.end(), esperado.begin(), esperado.end());
+}
+
+/**
+ * @brief Aplica una operación aleatoria al árbol y al conjunto esperado.
+ * @param insertar Probabilidad en porcentaje de insertar; el resto se reparte entre
+ * eliminar y, una de cada diez veces, InsertarLote.
+ * @return true si el resultado del árbol coincide con el de std::set.
+ */
+template <typename A>
+static bool Paso(A& arbol, std::set<int>& esperado, std::mt19937& g, int rango, unsigned insertar = 50) {
+    int x = static_cast<int>(g() % rango);
+    if (g() % 10 == 0) {
+        std::vector<int> lote(1 + g() % 40);
+        for (int& y : lote) y = static_cast<int>(g() % rango);
+        int nuevos = 0;
+        for (int y : lote) nuevos += esperado.insert(y).second;
+        return arbol.InsertarLote(lote.begin(), lote.end()) == nuevos;
+    }
+    if (g() % 100 < insertar) return arbol.Insertar(x) == esperado.insert(x).second;
+    return arbol.Eliminar(x) == (esperado.erase(x) > 0);
+}
+
+/**
+ * @brief Toma instantáneas durante una carga mixta y verifica que ninguna cambie.
+ * @details Las vistas se sueltan en orden aleatorio (no LIFO), algunas se copian, y el
+ * árbol se vacía mientras todavía hay vistas vivas.
+ */
+template <typename A>
+static void PruebaInstantaneas(const char* variante, int operaciones, int rango, unsigned semilla) {
+    A arbol;
+    std::set<int> esperado;
+    std::mt19937 g(semilla);
+    std::vector<typename A::Instantanea> vistas;
+    std::vector<std::set<int>> copias;
+
+    auto soltar = [&](std::size_t k) {
+        Verificar(Coincide(vistas[k], copias[k]), "una instantánea cambió", variante);
+        Verificar(vistas[k].CantElem() == static_cast<int>(copias[k].size()), "CantElem de una instantánea cambió", variante);
+        vistas.erase(vistas.begin() + k);
+        copias.erase(copias.begin() + k);
+    };
+
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        coincide = Paso(arbol, esperado, g, rango, 55) && coincide;
+
+        if (g() % 64 == 0) {
+            vistas.push_back(arbol.TomarInstantanea());
+            copias.push_back(esperado);
+            // A veces una copia de la vista, que comparte los mismos nodos
+            if (g() % 2 == 0) {
+                vistas.push_back(vistas.back());
+                copias.push_back(esperado);
+            }
+        }
+        if (!vistas.empty() && (vistas.size() > 6 || g() % 97 == 0)) soltar(g() % vistas.size());
+    }
+    Verificar(coincide, "Insertar, Eliminar o InsertarLote no coincide con std::set", variante);
+    Verificar(Coincide(arbol, esperado), "el árbol no coincide con std::set", variante);
+
+    // Vaciar con vistas vivas: los nodos compartidos siguen siendo de ellas
+    vistas.push_back(arbol.TomarInstantanea());
+    copias.push_back(esperado);
+    arbol.Vaciar();
+    Verificar(arbol.CantElem() == 0 && arbol.begin() == arbol.end(), "Vaciar dejó elementos", variante);
+    for (int i = 0; i < rango / 4; ++i) arbol.Insertar(static_cast<int>(g() % rango));
+    while (!vistas.empty()) soltar(g() % vistas.size());
+}
+
+/// Compara Rango, Seleccionar, ContarRango y Percentil con posiciones en el vector ordenado
+template <typename A>
+static bool OrdenCoincide(const A& arbol, const std::set<int>& esperado, std::mt19937& g, int rango, int muestras) {
+    std::vector<int> orden(esperado.begin(), esperado.end());
+    int n = static_cast<int>(orden.size());
+    auto menores = [&orden](int x) { return static_cast<int>(std::lower_bound(orden.begin(), orden.end(), x) - orden.begin()); };
+    auto hasta = [&orden](int x) { return static_cast<int>(std::upper_bound(orden.begin(), orden.end(), x) - orden.begin()); };
+
+    bool coincide = arbol.CantElem() == n;
+    if (n > 0) coincide = coincide && arbol.Seleccionar(0) == orden.front() && arbol.Seleccionar(n - 1) == orden.back();
+    for (int i = 0; i < muestras && coincide; ++i) {
+        int x = static_cast<int>(g() % (rango + 2)) - 1;
+        int y = static_cast<int>(g() % (rango + 2)) - 1;
+        coincide = arbol.Rango(x) == menores(x) && arbol.ContarRango(x, y) == std::max(0, hasta(y) - menores(x));
+        if (n > 0) {
+            int k = static_cast<int>(g() % n);
+            double p = (g() % 1001) / 1000.0;
+            coincide = coincide && arbol.Seleccionar(k) == orden[k] &&
+                       arbol.Percentil(p) == orden[static_cast<int>(std::lround(p * (n - 1)))];
+        }
+    }
+    return coincide;
+}
+
+/**
+ * @brief Verifica los estadísticos de orden a lo largo de una carga que crece y se achica.
+ * @details Las fases alternan inserciones (divisiones de la raíz, rotaciones y divisiones
+ * triples) con eliminaciones (préstamos y fusiones hasta casi vaciar el árbol). Entre medio
+ * se recarga con CargarOrdenado y se toman instantáneas, para que las modificaciones
+ * dupliquen nodos compartidos y los conteos de las copias también se verifiquen.
+ */
+template <typename A>
+static void PruebaOrden(const char* variante, int operaciones, int rango, unsigned semilla) {
+    A arbol;
+    std::set<int> esperado;
+    std::mt19937 g(semilla);
+    const double llenados[] = {2.0 / 3.0, 0.8, 1.0};
+    bool coincide = true;
+    bool ordenCoincide = true;
+    bool vistaCoincide = true;
+
+    for (int fase = 0; fase < 8; ++fase) {
+        unsigned insertar = fase % 2 == 0 ? 85 : 15;
+        if (fase == 4) {
+            std::vector<int> orden(esperado.begin(), esperado.end());
+            arbol.CargarOrdenado(orden.begin(), orden.end(), llenados[g() % 3]);
+        }
+        typename A::Instantanea vista = arbol.TomarInstantanea();
+        std::set<int> copia = esperado;
+
+        for (int i = 0; i < operaciones; ++i) {
+            coincide = Paso(arbol, esperado, g, rango, insertar) && coincide;
+            if (i % (operaciones / 8) == 0) ordenCoincide = OrdenCoincide(arbol, esperado, g, rango, 64) && ordenCoincide;
+        }
+        ordenCoincide = OrdenCoincide(arbol, esperado, g, rango, 4 * rango) && ordenCoincide;
+        vistaCoincide = Coincide(vista, copia) && vistaCoincide;
+    }
+    Verificar(coincide, "Insertar, Eliminar o InsertarLote no coincide con std::set", variante);
+    Verificar(ordenCoincide, "Rango, Seleccionar, ContarRango o Percentil no coincide con el vector ordenado", variante);
+    Verificar(vistaCoincide, "una instantánea cambió", variante);
+    Verificar(Coincide(arbol, esperado), "el árbol no coincide con std::set", variante);
+
+    bool lanzo = false;
+    try { arbol.Seleccionar(arbol.CantElem()); } catch (const std::out_of_range&) { lanzo = true; }
+    Verificar(lanzo, "Seleccionar fuera del árbol no lanzó std::out_of_range", variante);
+    arbol.Vaciar();
+    lanzo = false;
+    try { arbol.Percentil(0.5); } catch (const std::out_of_range&) { lanzo = true; }
+    Verificar(lanzo, "Percentil con el árbol vacío no lanzó std::out_of_range", variante);
+    Verificar(arbol.Rango(0) == 0 && arbol.ContarRango(0, rango) == 0, "Rango o ContarRango con el árbol vacío", variante);
+}
+
+/**
+ * @brief Inserta lotes aleatorios y compara la cantidad devuelta con std::set.
+ * @details Los lotes tienen repetidos y claves ya presentes, y sus largos van de vacío a
+ * largo (varias veces el grado), de modo que un mismo lote desborda varios nodos. La mitad
+ * se pasa ordenada con ordenado = true; un lote desordenado con ordenado = true debe lanzar
+ * std::invalid_argument sin tocar el árbol.
+ */
+template <typename A>
+static void PruebaLotes(const char* variante, int lotes, int largo, int rango, unsigned semilla) {
+    A arbol;
+    std::set<int> esperado;
+    std::mt19937 g(semilla);
+    bool coincide = true;
+
+    for (int i = 0; i < lotes; ++i) {
+        std::vector<int> lote(g() % (largo + 1));
+        for (int& y : lote) y = static_cast<int>(g() % rango);
+        // Algunos repetidos dentro del lote y algunas claves que ya están en el árbol
+        for (std::size_t k = 1; k < lote.size(); k += 1 + g() % 4) lote[k] = lote[k - 1];
+        if (!esperado.empty()) {
+            for (std::size_t k = 0; k < lote.size(); k += 1 + g() % 8) {
+                auto presente = esperado.lower_bound(lote[k]);
+                lote[k] = presente != esperado.end() ? *presente : *esperado.begin();
+            }
+        }
+
+        int nuevos = 0;
+        for (int y : lote) nuevos += esperado.insert(y).second;
+        bool ordenado = g() % 2 == 0;
+        if (ordenado) std::sort(lote.begin(), lote.end());
+        coincide = coincide && arbol.InsertarLote(lote.begin(), lote.end(), ordenado) == nuevos;
+
+        // Eliminaciones sueltas para que los lotes caigan también en nodos a medio llenar
+        for (int k = 0; k < largo / 8; ++k) {
+            int x = static_cast<int>(g() % rango);
+            coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+        }
+    }
+    Verificar(coincide, "la cantidad devuelta por InsertarLote no coincide con std::set", variante);
+    Verificar(Coincide(arbol, esperado), "el árbol no coincide con std::set", variante);
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide", variante);
+
+    // Todo ya presente, y un lote vacío
+    std::vector<int> presentes(esperado.begin(), esperado.end());
+    Verificar(arbol.InsertarLote(presentes.begin(), presentes.end(), true) == 0, "insertó claves ya presentes", variante);
+    Verificar(arbol.InsertarLote(presentes.begin(), presentes.begin()) == 0, "el lote vacío insertó algo", variante);
+
+    std::vector<int> desordenado = {rango + 3, rango + 1, rango + 2};
+    bool lanzo = false;
+    try { arbol.InsertarLote(desordenado.begin(), desordenado.end(), true); } catch (const std::invalid_argument&) { lanzo = true; }
+    Verificar(lanzo, "un lote desordenado con ordenado = true no lanzó std::invalid_argument", variante);
+    Verificar(Coincide(arbol, esperado), "el lote rechazado modificó el árbol", variante);
+
+    // Un lote grande ordenado sobre un árbol vacío
+    A vacio;
+    std::vector<int> todos(rango);
+    for (int k = 0; k < rango; ++k) todos[k] = k;
+    Verificar(vacio.InsertarLote(todos.begin(), todos.end(), true) == rango, "un lote grande no insertó todo", variante);
+    std::set<int> completo(todos.begin(), todos.end());
+    Verificar(Coincide(vacio, completo), "el lote grande no coincide con std::set", variante);
+}
+
+/**
+ * @brief Busca lotes con distintos patrones de aciertos y compara con std::set.
+ * @details BuscarLote avanza en grupos de 16 búsquedas intercaladas; los largos cubren
+ * grupos completos, incompletos y vacíos, y los patrones ponen aciertos y fallos en todas
+ * las posiciones del grupo (las claves encontradas quedan tanto en hojas como en nodos
+ * internos). Se verifican el vector de resultados y la cantidad devuelta.
+ */
+template <typename A>
+static void PruebaBuscarLote(const char* variante, int rango, unsigned semilla) {
+    A arbol;
+    std::set<int> esperado;
+    std::mt19937 g(semilla);
+    std::vector<int> claves;
+    std::vector<bool> resultados;
+    bool coincide = true;
+
+    auto buscar = [&]() {
+        resultados.clear();
+        int encontradas = arbol.BuscarLote(claves.begin(), claves.end(), std::back_inserter(resultados));
+        int cuantas = 0;
+        bool iguales = resultados.size() == claves.size();
+        for (std::size_t k = 0; iguales && k < claves.size(); ++k) {
+            bool esta = esperado.count(claves[k]) > 0;
+            cuantas += esta;
+            iguales = resultados[k] == esta;
+        }
+        coincide = coincide && iguales && encontradas == cuantas;
+    };
+
+    // Árbol vacío: todo falla, pero igual se escribe un resultado por clave
+    claves.assign(37, 1);
+    buscar();
+
+    // Solo las claves pares, así las impares son fallos entre dos presentes
+    for (int i = 0; i < rango; ++i) {
+        int x = 2 * static_cast<int>(g() % rango);
+        arbol.Insertar(x);
+        esperado.insert(x);
+    }
+    std::vector<int> presentes(esperado.begin(), esperado.end());
+
+    for (int largo : {0, 1, 15, 16, 17, 31, 32, 33, 48, 100, 1000}) {
+        for (int patron = 0; patron < 6; ++patron) {
+            claves.resize(largo);
+            for (int k = 0; k < largo; ++k) {
+                bool acierto;
+                switch (patron) {
+                    case 0: acierto = true; break;
+                    case 1: acierto = false; break;
+                    case 2: acierto = k % 2 == 0; break;
+                    case 3: acierto = k % 16 == 0 || k % 16 == 15; break;
+                    case 4: acierto = k % 16 != 7; break;
+                    default: acierto = g() % 2 == 0; break;
+                }
+                int presente = presentes[g() % presentes.size()];
+                // Los fallos caen dentro del rango, afuera por debajo o afuera por arriba
+                claves[k] = acierto ? presente : (g() % 8 == 0 ? -1 - presente : presente + 1);
+            }
+            buscar();
+        }
+    }
+
+    // Repetidos dentro del mismo grupo
+    claves.assign(40, presentes[0]);
+    for (std::size_t k = 0; k < claves.size(); k += 3) claves[k] = presentes[0] + 1;
+    buscar();
+
+    Verificar(coincide, "BuscarLote no coincide con std::set", variante);
+}
+
+/**
+ * @brief Carga secuencias ordenadas de varios tamaños y llenados, y luego las modifica.
+ * @details Se alternan CargarOrdenado sobre un árbol con contenido y el constructor por
+ * rango. Tras cada carga se verifican contenido, conteos, que ningún nodo fuera de la raíz
+ * quede bajo el mínimo (salvo los dos únicos hijos de la raíz) y, con muchos nodos, que el llenado medio sea el pedido; después
+ * una tanda de inserciones y eliminaciones debe seguir coincidiendo con std::set.
+ */
+template <int grado>
+static void PruebaCarga(const char* variante, unsigned semilla) {
+    using A = Arbol<grado, true>;
+    std::mt19937 g(semilla);
+    const int minimo = 2 * (grado - 1) / 3;
+    bool coincide = true;
+    bool estructura = true;
+
+    for (int n : {0, 1, 2, 3, 4, 5, 7, 10, grado - 1, grado, grado + 1, 3 * grado, 100, 1000, 200 * grado}) {
+        for (double llenado : {2.0 / 3.0, 0.8, 1.0}) {
+            std::vector<int> orden(n);
+            for (int k = 0; k < n; ++k) orden[k] = 3 * k;
+            std::set<int> esperado(orden.begin(), orden.end());
+            // Repetidos consecutivos: se cargan una sola vez
+            if (n > 0) orden.insert(orden.begin() + g() % n, orden[g() % n]);
+            std::sort(orden.begin(), orden.end());
+
+            A cargado(orden.begin(), orden.end(), llenado);
+            A recargado;
+            for (int k = 0; k < 50; ++k) recargado.Insertar(static_cast<int>(g() % 1000) - 2000);
+            recargado.CargarOrdenado(orden.begin(), orden.end(), llenado);
+
+            for (A* arbol : {&cargado, &recargado}) {
+                coincide = coincide && Coincide(*arbol, esperado) && OrdenCoincide(*arbol, esperado, g, 3 * n, 64);
+                EstadisticasArbol e = arbol->Estadisticas();
+                // Dos hermanos solos bajo la raíz pueden quedar a medias, como tras dividir la raíz
+                bool hermanos = e.nodosPorNivel.size() < 2 || e.nodosPorNivel[1] >= 3;
+                for (int k = 0; hermanos && k < EstadisticasArbol::cubetas; ++k) {
+                    if ((k + 1) * (grado - 1) <= 10 * minimo) estructura = estructura && e.histogramaLlenado[k] == 0;
+                }
+                if (n >= 200 * grado) {
+                    double pedido = std::max(std::lround(llenado * (grado - 1)), static_cast<long>(minimo)) / double(grado - 1);
+                    estructura = estructura && std::abs(e.llenadoMedio - pedido) < 0.02;
+                }
+
+                std::set<int> modificado = esperado;
+                for (int k = 0; k < 2 * n + 20; ++k) coincide = Paso(*arbol, modificado, g, 3 * n + 3) && coincide;
+                coincide = coincide && Coincide(*arbol, modificado) && OrdenCoincide(*arbol, modificado, g, 3 * n + 3, 64);
+            }
+        }
+    }
+    Verificar(coincide, "el contenido cargado (o modificado después) no coincide con std::set", variante);
+    Verificar(estructura, "la carga dejó nodos bajo el mínimo o un llenado distinto del pedido", variante);
+
+    std::vector<int> desordenado = {1, 3, 2};
+    A arbol(desordenado.begin(), desordenado.begin() + 2);
+    bool lanzo = false;
+    try { arbol.CargarOrdenado(desordenado.begin(), desordenado.end()); } catch (const std::invalid_argument&) { lanzo = true; }
+    Verificar(lanzo, "una secuencia desordenada no lanzó std::invalid_argument", variante);
+    for (double llenado : {0.5, 1.1}) {
+        lanzo = false;
+        try { arbol.CargarOrdenado(desordenado.begin(), desordenado.begin() + 2, llenado); } catch (const std::invalid_argument&) { lanzo = true; }
+        Verificar(lanzo, "un llenado fuera de [2/3, 1] no lanzó std::invalid_argument", variante);
+    }
+}
+
+/**
+ * @brief Compara iteradores, cotas y recorrido inverso con los de std::set.
+ * @details Desde cada cota se camina unos pasos hacia adelante y hacia atrás, de modo que
+ * operator++ y operator-- crucen de hojas a separadoras y entre subárboles; además se
+ * recorre todo el árbol hacia atrás desde end() y con rbegin().
+ */
+template <typename A>
+static void PruebaIteradores(const char* variante, int operaciones, int rango, unsigned semilla) {
+    A arbol;
+    std::set<int> esperado;
+    std::mt19937 g(semilla);
+    const A& constante = arbol;
+
+    Verificar(constante.begin() == constante.end() && constante.rbegin() == constante.rend() &&
+              constante.lower_bound(0) == constante.end() && constante.upper_bound(0) == constante.end(),
+              "los iteradores del árbol vacío no coinciden", variante);
+
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) coincide = Paso(arbol, esperado, g, rango, 60) && coincide;
+    Verificar(coincide, "Insertar, Eliminar o InsertarLote no coincide con std::set", variante);
+
+    Verificar(Coincide(constante, esperado), "el recorrido no coincide", variante);
+    Verificar(std::equal(constante.rbegin(), constante.rend(), esperado.rbegin(), esperado.rend()),
+              "el recorrido con rbegin no coincide", variante);
+
+    // Hacia atrás desde end() con operator-- (prefijo y sufijo alternados)
+    bool atras = true;
+    auto it = constante.end();
+    auto esp = esperado.end();
+    while (atras && esp != esperado.begin()) {
+        if (g() % 2 == 0) {
+            --it;
+            --esp;
+        } else {
+            it--;
+            esp--;
+        }
+        atras = *it == *esp;
+    }
+    Verificar(atras && it == constante.begin(), "el recorrido hacia atrás con operator-- no coincide", variante);
+
+    bool cotas = true;
+    bool pasos = true;
+    for (int i = 0; i < 4 * rango; ++i) {
+        int x = static_cast<int>(g() % (rango + 2)) - 1;
+        auto inferior = constante.lower_bound(x);
+        auto superior = constante.upper_bound(x);
+        auto esperadoInferior = esperado.lower_bound(x);
+        auto esperadoSuperior = esperado.upper_bound(x);
+        auto igual = [&](typename A::const_iterator a, std::set<int>::const_iterator b) {
+            return (a == constante.end()) == (b == esperado.end()) && (b == esperado.end() || *a == *b);
+        };
+        auto rangoIgual = constante.equal_range(x);
+        cotas = cotas && igual(inferior, esperadoInferior) && igual(superior, esperadoSuperior) &&
+                rangoIgual.first == inferior && rangoIgual.second == superior;
+
+        // Unos pasos desde la cota inferior, con copias del iterador que no deben moverse
+        typename A::const_iterator copia;
+        copia = inferior;
+        for (int k = 0; pasos && k < 8; ++k) {
+            if (g() % 2 == 0 && esperadoInferior != esperado.end()) {
+                ++inferior;
+                ++esperadoInferior;
+            } else if (esperadoInferior != esperado.begin()) {
+                --inferior;
+                --esperadoInferior;
+            }
+            pasos = igual(inferior, esperadoInferior);
+        }
+        pasos = pasos && igual(copia, esperado.lower_bound(x));
+    }
+    Verificar(cotas, "lower_bound, upper_bound o equal_range no coincide con std::set", variante);
+    Verificar(pasos, "operator++ u operator-- desde una cota no coincide con std::set", variante);
+}
+
+/**
+ * @brief Verifica que Colocar devuelva un iterador a la clave, se haya insertado o no.
+ * @details Con grado chico casi todas las inserciones reorganizan nodos, así que se cubren
+ * tanto el iterador armado durante el descenso como el que se busca de nuevo.
+ */
+template <int grado>
+static void PruebaColocar(const char* variante, int operaciones, int rango, unsigned semilla) {
+    StarBTree<int, grado, TrazaNula, PoolNodos, std::less<int>, false, DesbordeVecino, int> arbol;
+    std::map<int, int> esperado;
+    std::mt19937 g(semilla);
+    bool coincide = true;
+    for (int i = 0; i < operaciones && coincide; ++i) {
+        int x = static_cast<int>(g() % rango);
+        if (g() % 4 == 0) {
+            coincide = arbol.Eliminar(x) == (esperado.erase(x) > 0);
+            continue;
+        }
+        int valor = static_cast<int>(g());
+        auto colocado = arbol.Colocar(x, valor);
+        auto previsto = esperado.try_emplace(x, valor);
+        auto siguiente = std::next(previsto.first);
+        auto it = colocado.first;
+        ++it;
+        coincide = colocado.second == previsto.second && *colocado.first == x &&
+                   colocado.first.carga() == previsto.first->second &&
+                   (siguiente == esperado.end() ? it == arbol.end() : *it == siguiente->first);
+    }
+    Verificar(coincide, "Colocar no devolvió un iterador a la clave", variante);
+}
+
+/**
+ * @brief Verifica que las cargas se modifiquen con iterator y solo se lean con const_iterator.
+ */
+template <int grado>
+static void PruebaCargaModificable(const char* variante, int n) {
+    using A = StarBTree<int, grado, TrazaNula, PoolNodos, std::less<int>, false, DesbordeVecino, int>;
+    static_assert(std::is_same<decltype(std::declval<typename A::const_iterator>().carga()), const int&>::value,
+                  "const_iterator no debe permitir modificar la carga");
+    static_assert(std::is_same<decltype(std::declval<typename A::iterator>().carga()), int&>::value,
+                  "iterator debe permitir modificar la carga");
+    A arbol;
+    for (int i = 0; i < n; ++i) arbol.Colocar(i, i);
+    for (typename A::iterator it = arbol.Modificable(arbol.begin()); it != arbol.end(); ++it) {
+        it.carga() = -*it;
+    }
+    const A& lectura = arbol;
+    bool modificado = true;
+    int cuantos = 0;
+    for (auto it = lectura.begin(); it != lectura.end(); ++it, ++cuantos) modificado = modificado && it.carga() == -*it;
+    Verificar(modificado && cuantos == n, "el árbol no conserva las cargas modificadas", variante);
+}
+
+int main() {
+    PruebaInstantaneas<Arbol<3>>("instantáneas grado 3", 20000, 500, 1);
+    PruebaInstantaneas<Arbol<3, true>>("instantáneas grado 3 con conteos", 20000, 500, 2);
+    PruebaInstantaneas<Arbol<64>>("instantáneas grado 64", 50000, 20000, 3);
+    PruebaInstantaneas<Arbol<64, true>>("instantáneas grado 64 con conteos", 50000, 20000, 4);
+
+    PruebaOrden<Arbol<3, true, DesbordeClasico>>("orden grado 3 clásico", 4000, 600, 5);
+    PruebaOrden<Arbol<3, true, DesbordeTriple>>("orden grado 3 triple", 4000, 600, 6);
+    PruebaOrden<Arbol<3, true, DesbordeVecino>>("orden grado 3 vecino", 4000, 600, 7);
+    PruebaOrden<Arbol<3, true, DesbordeCascada>>("orden grado 3 cascada", 4000, 600, 8);
+    PruebaOrden<Arbol<64, true, DesbordeClasico>>("orden grado 64 clásico", 20000, 20000, 9);
+    PruebaOrden<Arbol<64, true, DesbordeTriple>>("orden grado 64 triple", 20000, 20000, 10);
+    PruebaOrden<Arbol<64, true, DesbordeVecino>>("orden grado 64 vecino", 20000, 20000, 11);
+    PruebaOrden<Arbol<64, true, DesbordeCascada>>("orden grado 64 cascada", 20000, 20000, 12);
+
+    PruebaLotes<Arbol<3>>("lotes grado 3", 2000, 24, 2000, 13);
+    PruebaLotes<Arbol<3, true>>("lotes grado 3 con conteos", 2000, 24, 2000, 14);
+    PruebaLotes<Arbol<64>>("lotes grado 64", 400, 512, 50000, 15);
+    PruebaLotes<Arbol<64, true, DesbordeCascada>>("lotes grado 64 cascada con conteos", 400, 512, 50000, 16);
+
+    PruebaBuscarLote<Arbol<3>>("búsqueda en lote grado 3", 2000, 17);
+    PruebaBuscarLote<Arbol<64>>("búsqueda en lote grado 64", 50000, 18);
+
+    PruebaCarga<3>("carga grado 3", 19);
+    PruebaCarga<4>("carga grado 4", 20);
+    PruebaCarga<64>("carga grado 64", 21);
+
+    PruebaIteradores<Arbol<3>>("iteradores grado 3", 5000, 1000, 22);
+    PruebaIteradores<Arbol<3, true>>("iteradores grado 3 con conteos", 5000, 1000, 23);
+    PruebaIteradores<Arbol<64>>("iteradores grado 64", 50000, 20000, 24);
+
+    PruebaColocar<3>("colocar grado 3", 20000, 2000, 25);
+    PruebaColocar<32>("colocar grado 32", 50000, 20000, 26);
+
+    PruebaCargaModificable<3>("cargas modificables grado 3", 3000);
+    PruebaCargaModificable<32>("cargas modificables grado 32", 20000);
+
+    if (fallos > 0) {
+        std::fprintf(stderr, "%d verificaciones fallaron\n", fallos);
+        return 1;
+    }
+    std::printf("starbtree: ok\n");
+    return 0;
+}
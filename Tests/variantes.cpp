@@ -0,0 +1,260 @@
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "../Headers/StarBPlusTree.hpp"
+#include "../Headers/StarBTree.hpp"
+#include "../Headers/StarBTreeCadenas.hpp"
+#include "../Headers/StarBTreeDurable.hpp"
+#include "../Headers/StarBTreeEnteros.hpp"
+#include "../Headers/StarBTreeImagen.hpp"
+#include "../Headers/StarBTreeMap.hpp"
+#include "../Headers/StarBTreePaginado.hpp"
+
+/**
+ * @file variantes.cpp
+ * @brief Compara cada variante del Árbol B* con std::set o std::map bajo una carga aleatoria.
+ * @details Cada prueba mezcla inserciones y, si la variante las admite, eliminaciones en un
+ * rango chico (muchas repeticiones y reorganizaciones), y al final compara el contenido en
+ * orden. Las variantes persistentes se cierran y se vuelven a abrir antes de comparar; sus
+ * archivos van a un directorio temporal que se borra al terminar.
+ */
+
+static int fallos = 0;
+
+static void Verificar(bool condicion, const char* mensaje, const char* variante) {
+    if (!condicion) {
+        std::fprintf(stderr, "FALLO (%s): %s\n", variante, mensaje);
+        ++fallos;
+    }
+}
+
+/// Contenido en orden de una variante que ofrece RecorrerRango
+template <typename Arbol, typename Type>
+static std::vector<Type> Contenido(const Arbol& arbol, const Type& desde, const Type& hasta) {
+    std::vector<Type> contenido;
+    arbol.RecorrerRango(desde, hasta, [&contenido](const Type& clave) { contenido.push_back(clave); });
+    return contenido;
+}
+
+template <typename Type>
+static std::vector<Type> Contenido(const std::set<Type>& esperado) {
+    return std::vector<Type>(esperado.begin(), esperado.end());
+}
+
+template <int grado, typename Desborde = DesbordeVecino, typename Compare = std::less<int>>
+static void PruebaPlus(int operaciones, int rango) {
+    StarBPlusTree<int, grado, TrazaNula, PoolNodos, Compare, Desborde> arbol;
+    std::set<int, Compare> esperado;
+    std::mt19937 g(grado);
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        int x = static_cast<int>(g() % rango);
+        if (g() % 3 == 0) {
+            coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+        } else {
+            coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+        }
+    }
+    Verificar(coincide, "Insertar o Eliminar no coincide con std::set", "StarBPlusTree");
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide", "StarBPlusTree");
+    Verificar(std::vector<int>(arbol.begin(), arbol.end()) == std::vector<int>(esperado.begin(), esperado.end()),
+              "el recorrido no coincide", "StarBPlusTree");
+    Verificar(std::vector<int>(arbol.rbegin(), arbol.rend()) == std::vector<int>(esperado.rbegin(), esperado.rend()),
+              "el recorrido inverso no coincide", "StarBPlusTree");
+}
+
+template <int grado>
+static void PruebaMap(int operaciones, int rango) {
+    StarBTreeMap<int, std::string, grado> mapa;
+    std::map<int, std::string> esperado;
+    std::mt19937 g(grado);
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        int x = static_cast<int>(g() % rango);
+        std::string valor = std::to_string(g());
+        switch (g() % 4) {
+            case 0: coincide = coincide && mapa.Eliminar(x) == (esperado.erase(x) > 0); break;
+            case 1: mapa[x] += valor; esperado[x] += valor; break;
+            case 2: coincide = coincide && mapa.insert_or_assign(x, valor).second == esperado.insert_or_assign(x, valor).second; break;
+            default: coincide = coincide && mapa.try_emplace(x, valor).second == esperado.try_emplace(x, valor).second; break;
+        }
+    }
+    Verificar(coincide, "las operaciones no coinciden con std::map", "StarBTreeMap");
+    Verificar(mapa.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide", "StarBTreeMap");
+    std::vector<std::pair<int, std::string>> pares;
+    for (auto par : mapa) pares.emplace_back(par.first, par.second);
+    Verificar(pares == std::vector<std::pair<int, std::string>>(esperado.begin(), esperado.end()),
+              "el recorrido no coincide", "StarBTreeMap");
+}
+
+template <std::size_t bytes>
+static void PruebaPorBytes(int operaciones, int rango) {
+    StarBTreePorBytes<long, bytes> arbol;
+    std::set<long> esperado;
+    std::mt19937 g(bytes);
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        long x = static_cast<long>(g() % rango);
+        if (g() % 3 == 0) {
+            coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+        } else {
+            coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+        }
+    }
+    Verificar(coincide, "Insertar o Eliminar no coincide con std::set", "StarBTreePorBytes");
+    Verificar(std::vector<long>(arbol.begin(), arbol.end()) == Contenido(esperado), "el recorrido no coincide", "StarBTreePorBytes");
+}
+
+template <int grado, typename Desborde = DesbordeVecino>
+static void PruebaPaginado(const std::string& ruta, int operaciones, int rango) {
+    std::set<int> esperado;
+    std::mt19937 g(grado);
+    {
+        // Pocos marcos: las páginas entran y salen del búfer durante las divisiones
+        StarBTreePaginado<int, grado, std::less<int>, Desborde> arbol(ruta, 8);
+        bool coincide = true;
+        for (int i = 0; i < operaciones; ++i) {
+            int x = static_cast<int>(g() % rango);
+            coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+        }
+        Verificar(coincide, "Insertar no coincide con std::set", "StarBTreePaginado");
+    }
+    StarBTreePaginado<int, grado, std::less<int>, Desborde> arbol(ruta, 8);
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide al reabrir", "StarBTreePaginado");
+    Verificar(Contenido(arbol, 0, rango) == Contenido(esperado), "el contenido no coincide al reabrir", "StarBTreePaginado");
+    Verificar(!arbol.Buscar(rango), "encontró una clave nunca insertada", "StarBTreePaginado");
+}
+
+template <int grado>
+static void PruebaImagen(const std::string& ruta, int operaciones, int rango) {
+    StarBTree<int, grado> arbol;
+    std::set<int> esperado;
+    std::mt19937 g(grado);
+    for (int i = 0; i < operaciones; ++i) {
+        int x = static_cast<int>(g() % rango);
+        arbol.Insertar(x);
+        esperado.insert(x);
+    }
+    arbol.Guardar(ruta);
+
+    StarBTreeImagen<int> imagen(ruta);
+    Verificar(imagen.CantElem() == esperado.size(), "CantElem no coincide", "StarBTreeImagen");
+    Verificar(Contenido(imagen, 0, rango) == Contenido(esperado), "el contenido no coincide", "StarBTreeImagen");
+    bool coincide = true;
+    for (int x = -1; x <= rango; ++x) coincide = coincide && imagen.Buscar(x) == (esperado.count(x) > 0);
+    Verificar(coincide, "Buscar no coincide con std::set", "StarBTreeImagen");
+}
+
+template <int grado>
+static void PruebaDurable(const std::string& ruta, int operaciones, int rango) {
+    std::set<int> esperado;
+    std::mt19937 g(grado);
+    auto operar = [&](StarBTreeDurable<int, grado>& arbol) {
+        bool coincide = true;
+        for (int i = 0; i < operaciones; ++i) {
+            int x = static_cast<int>(g() % rango);
+            if (g() % 3 == 0) {
+                coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+            } else {
+                coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+            }
+        }
+        Verificar(coincide, "Insertar o Eliminar no coincide con std::set", "StarBTreeDurable");
+    };
+
+    {
+        StarBTreeDurable<int, grado> arbol(ruta);
+        operar(arbol);
+        arbol.PuntoControl();
+        operar(arbol);
+        arbol.Confirmar();
+    }
+    // Se recupera de la imagen del punto de control más la bitácora
+    StarBTreeDurable<int, grado> arbol(ruta);
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide al recuperar", "StarBTreeDurable");
+    Verificar(Contenido(arbol.Contenido(), 0, rango) == Contenido(esperado), "el contenido no coincide al recuperar", "StarBTreeDurable");
+}
+
+template <int grado>
+static void PruebaCadenas(int operaciones, int rango) {
+    StarBTreeCadenas<grado> arbol;
+    std::set<std::string> esperado;
+    std::mt19937 g(grado);
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        // Prefijos largos compartidos y algunas claves cortas o vacías
+        std::string x = "https://example.com/ruta/" + std::to_string(g() % rango);
+        if (g() % 5 == 0) x.assign(g() % 4, static_cast<char>('a' + g() % 3));
+        if (g() % 3 == 0) {
+            coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+        } else {
+            coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+        }
+    }
+    Verificar(coincide, "Insertar o Eliminar no coincide con std::set", "StarBTreeCadenas");
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide", "StarBTreeCadenas");
+    Verificar(Contenido(arbol, std::string(), std::string("\xff")) == Contenido(esperado), "el contenido no coincide", "StarBTreeCadenas");
+}
+
+template <int grado, int gradoHoja>
+static void PruebaEnteros(int operaciones, long long paso) {
+    StarBTreeEnteros<long long, grado, gradoHoja> arbol;
+    std::set<long long> esperado;
+    std::mt19937 g(grado);
+    bool coincide = true;
+    for (int i = 0; i < operaciones; ++i) {
+        // El paso decide el ancho de los desplazamientos en las hojas
+        long long x = static_cast<long long>(g() % operaciones) * paso - paso;
+        if (g() % 3 == 0) {
+            coincide = coincide && arbol.Eliminar(x) == (esperado.erase(x) > 0);
+        } else {
+            coincide = coincide && arbol.Insertar(x) == esperado.insert(x).second;
+        }
+    }
+    Verificar(coincide, "Insertar o Eliminar no coincide con std::set", "StarBTreeEnteros");
+    Verificar(arbol.CantElem() == static_cast<int>(esperado.size()), "CantElem no coincide", "StarBTreeEnteros");
+    Verificar(Contenido(arbol, -paso, operaciones * paso) == Contenido(esperado), "el contenido no coincide", "StarBTreeEnteros");
+}
+
+int main() {
+    std::filesystem::path directorio = std::filesystem::temp_directory_path() / "starbtree-variantes";
+    std::filesystem::remove_all(directorio);
+    std::filesystem::create_directories(directorio);
+
+    PruebaPlus<3>(20000, 2000);
+    PruebaPlus<16>(50000, 20000);
+    PruebaPlus<3, DesbordeClasico>(20000, 2000);
+    PruebaPlus<4, DesbordeCascada>(20000, 2000);
+    PruebaPlus<16, DesbordeTriple>(50000, 20000);
+    PruebaPlus<8, DesbordeVecino, std::greater<int>>(30000, 5000);
+    PruebaMap<4>(20000, 2000);
+    PruebaMap<32>(50000, 20000);
+    PruebaPorBytes<64>(20000, 2000);
+    PruebaPorBytes<256>(50000, 20000);
+    PruebaPaginado<3>((directorio / "paginado3").string(), 5000, 5000);
+    PruebaPaginado<64>((directorio / "paginado64").string(), 50000, 100000);
+    PruebaPaginado<3, DesbordeClasico>((directorio / "paginado3c").string(), 5000, 5000);
+    PruebaPaginado<4, DesbordeCascada>((directorio / "paginado4s").string(), 5000, 5000);
+    PruebaPaginado<16, DesbordeTriple>((directorio / "paginado16t").string(), 20000, 50000);
+    PruebaImagen<4>((directorio / "imagen4").string(), 5000, 5000);
+    PruebaImagen<64>((directorio / "imagen64").string(), 50000, 100000);
+    PruebaDurable<8>((directorio / "durable").string(), 10000, 5000);
+    PruebaCadenas<3>(10000, 2000);
+    PruebaCadenas<16>(50000, 20000);
+    PruebaEnteros<3, 3>(10000, 1);
+    PruebaEnteros<16, 64>(50000, 1);
+    PruebaEnteros<16, 64>(50000, 1000003);
+
+    std::filesystem::remove_all(directorio);
+    if (fallos > 0) {
+        std::fprintf(stderr, "%d verificaciones fallaron\n", fallos);
+        return 1;
+    }
+    std::printf("variantes: ok\n");
+    return 0;
+}